@@ -0,0 +1,374 @@
+/*
+ * Allocators.h
+ *
+ * Allocators for the Dynamic Array (or any standard container) that avoid going to the global heap for every allocation.
+ *
+ * An Arena hands out memory by bumping a pointer through large blocks, and frees everything at once when it is reset, e.g. at the end of a request.
+ * A Pool keeps free lists of power of two size classes, so memory freed by one array is reused by the next array of a similar size.
+ * ArenaAllocator and PoolAllocator adapt them to the standard allocator requirements, e.g. DynamicArray<int, ArenaAllocator<int>> array(ArenaAllocator<int>(arena)).
+ *
+ * DISCLAIMER: This implementation is intended for portfolio/education purposes only.
+ * For production use, it is recommended to use std::pmr::monotonic_buffer_resource and std::pmr::synchronized_pool_resource instead.
+ *
+ *  Copyright Peter Hoghton. All rights reserved.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+// Monotonic allocator that carves allocations out of large blocks and frees them all at once
+// Note: Not thread safe, so use one per thread (or per request).
+class Arena
+{
+public:
+	// Constructor with block size argument - blocks are allocated from the global heap as they are needed
+	explicit Arena(const size_t blockSize = s_defaultBlockSize) : m_blockSize(blockSize) {}
+
+	// Copying an arena would free its blocks twice
+	Arena(const Arena&) = delete;
+	Arena& operator=(const Arena&) = delete;
+
+	// Default destructor - frees every block
+	~Arena()
+	{
+		while (m_first != nullptr)
+		{
+			Block* next = m_first->m_next;
+			::operator delete(m_first);
+			m_first = next;
+		}
+	}
+
+	// Returns memory for the given number of bytes with the given alignment
+	void* Allocate(const size_t size, const size_t alignment = alignof(std::max_align_t))
+	{
+		uintptr_t address = Align(m_top, alignment);
+		if (m_current == nullptr || address + size > m_end || address < m_top)
+		{
+			NextBlock(size + alignment);
+			address = Align(m_top, alignment);
+		}
+		m_top = address + size;
+		return reinterpret_cast<void*>(address);
+	}
+
+	// Returns the total size of the blocks allocated from the global heap
+	size_t Capacity() const
+	{
+		size_t capacity = 0;
+		for (const Block* block = m_first; block != nullptr; block = block->m_next)
+		{
+			capacity += block->m_size;
+		}
+		return capacity;
+	}
+
+	// Frees the memory if it was the most recent allocation, otherwise it is only freed when the arena is reset
+	// Note: This lets an array that grows without other allocations in between reuse its previous storage.
+	void Deallocate(void* data, const size_t size)
+	{
+		if (reinterpret_cast<uintptr_t>(data) + size == m_top)
+		{
+			m_top = reinterpret_cast<uintptr_t>(data);
+		}
+	}
+
+	// Frees all allocations in O(1), keeping the blocks to be reused
+	// Note: Anything allocated from the arena must not be used afterwards, but arrays using it may still be destroyed.
+	void Reset()
+	{
+		m_current = m_first;
+		m_top = (m_first != nullptr) ? Begin(m_first) : 0;
+		m_end = (m_first != nullptr) ? End(m_first) : 0;
+	}
+
+private:
+	// Header at the start of each block
+	struct Block
+	{
+		Block* m_next; // The next block, which may be left over from before the arena was reset
+		size_t m_size; // The size of the block including this header
+	};
+
+	// Rounds the address up to the given alignment (a power of two)
+	static uintptr_t Align(const uintptr_t address, const size_t alignment)
+	{
+		return (address + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+	}
+
+	// Returns the address of the first byte available in the block
+	static uintptr_t Begin(Block* block)
+	{
+		return reinterpret_cast<uintptr_t>(block) + sizeof(Block);
+	}
+
+	// Returns the address one past the last byte of the block
+	static uintptr_t End(Block* block)
+	{
+		return reinterpret_cast<uintptr_t>(block) + block->m_size;
+	}
+
+	// Moves on to the next block with room for the given number of bytes, reusing blocks kept by a reset if possible
+	void NextBlock(const size_t size)
+	{
+		Block* next = (m_current != nullptr) ? m_current->m_next : m_first;
+		if (next == nullptr || next->m_size - sizeof(Block) < size)
+		{
+			const size_t blockSize = (size + sizeof(Block) > m_blockSize) ? size + sizeof(Block) : m_blockSize;
+			Block* block = static_cast<Block*>(::operator new(blockSize));
+			block->m_next = next;
+			block->m_size = blockSize;
+			(m_current != nullptr ? m_current->m_next : m_first) = block;
+			next = block;
+		}
+
+		m_current = next;
+		m_top = Begin(next);
+		m_end = End(next);
+	}
+
+	static constexpr size_t s_defaultBlockSize = 64 * 1024; // The default size of each block allocated from the global heap (64 KB)
+
+	Block* m_first = nullptr; // The first block, in the order they are used
+	Block* m_current = nullptr; // The block currently being allocated from
+	uintptr_t m_top = 0; // The address of the next free byte in the current block
+	uintptr_t m_end = 0; // The address one past the end of the current block
+	size_t m_blockSize; // The size of each block allocated from the global heap
+};
+
+// Thread safe allocator that keeps a free list for each power of two size class
+// Note: Allocations larger than the largest size class, or over-aligned ones, go straight to the global heap.
+class Pool
+{
+public:
+	// Default constructor
+	Pool() = default;
+
+	// Copying a pool would free its chunks twice
+	Pool(const Pool&) = delete;
+	Pool& operator=(const Pool&) = delete;
+
+	// Default destructor - frees every chunk, including memory that was never given back
+	~Pool()
+	{
+		for (void* chunk : m_chunks)
+		{
+			::operator delete(chunk);
+		}
+	}
+
+	// Returns memory for the given number of bytes with the given alignment
+	void* Allocate(const size_t size, const size_t alignment = alignof(std::max_align_t))
+	{
+		if (size > s_maxPooledSize || alignment > s_minPooledSize)
+		{
+			return ::operator new(size, std::align_val_t{ alignment });
+		}
+
+		SizeClass& sizeClass = m_sizeClasses[SizeClassIndex(size)];
+		std::lock_guard<SpinLock> lock(sizeClass.m_lock);
+		if (sizeClass.m_free == nullptr)
+		{
+			Refill(sizeClass, SizeClassSize(SizeClassIndex(size)));
+		}
+
+		Node* node = sizeClass.m_free;
+		sizeClass.m_free = node->m_next;
+		return node;
+	}
+
+	// Gives the memory back to the free list of its size class, where the size and alignment must match those it was allocated with
+	void Deallocate(void* data, const size_t size, const size_t alignment = alignof(std::max_align_t))
+	{
+		if (size > s_maxPooledSize || alignment > s_minPooledSize)
+		{
+			::operator delete(data, std::align_val_t{ alignment });
+			return;
+		}
+
+		SizeClass& sizeClass = m_sizeClasses[SizeClassIndex(size)];
+		std::lock_guard<SpinLock> lock(sizeClass.m_lock);
+		Node* node = static_cast<Node*>(data);
+		node->m_next = sizeClass.m_free;
+		sizeClass.m_free = node;
+	}
+
+private:
+	// Free memory in a size class, linked through its first bytes
+	struct Node
+	{
+		Node* m_next; // The next free node in the size class
+	};
+
+	// Lock that spins instead of sleeping, as it is only held to pop or push a node
+	// Note: This halves the cost of an uncontended allocation compared to std::mutex. The lowercase methods let it be used with std::lock_guard.
+	class SpinLock
+	{
+	public:
+		// Acquires the lock, yielding to other threads while it is held elsewhere
+		void lock()
+		{
+			while (m_locked.test_and_set(std::memory_order_acquire))
+			{
+				while (m_locked.test(std::memory_order_relaxed))
+				{
+					std::this_thread::yield();
+				}
+			}
+		}
+
+		// Releases the lock
+		void unlock()
+		{
+			m_locked.clear(std::memory_order_release);
+		}
+
+	private:
+		std::atomic_flag m_locked; // Whether the lock is held
+	};
+
+	// Free list for one size class
+	struct SizeClass
+	{
+		SpinLock m_lock; // Guards the free list, so that size classes can be used concurrently
+		Node* m_free = nullptr; // The first free node
+	};
+
+	// Returns the index of the smallest size class that can hold the given number of bytes
+	static size_t SizeClassIndex(const size_t size)
+	{
+		return static_cast<size_t>(std::bit_width((size > s_minPooledSize ? size : s_minPooledSize) - 1)) - std::countr_zero(s_minPooledSize);
+	}
+
+	// Returns the size of each node in the size class
+	static size_t SizeClassSize(const size_t index)
+	{
+		return s_minPooledSize << index;
+	}
+
+	// Splits a new chunk from the global heap into nodes for the size class
+	void Refill(SizeClass& sizeClass, const size_t size)
+	{
+		char* chunk = static_cast<char*>(::operator new(s_chunkSize));
+		{
+			std::lock_guard<std::mutex> lock(m_chunksMutex);
+			m_chunks.push_back(chunk);
+		}
+
+		// Nodes are linked in reverse so that they are handed out in address order
+		for (size_t count = s_chunkSize / size; count > 0; --count)
+		{
+			Node* node = reinterpret_cast<Node*>(chunk + (count - 1) * size);
+			node->m_next = sizeClass.m_free;
+			sizeClass.m_free = node;
+		}
+	}
+
+	static constexpr size_t s_minPooledSize = 16; // The size of the smallest size class, which is also the alignment of every node
+	static constexpr size_t s_maxPooledSize = 4096; // The size of the largest size class, larger allocations go to the global heap
+	static constexpr size_t s_sizeClassCount = std::countr_zero(s_maxPooledSize) - std::countr_zero(s_minPooledSize) + 1; // The number of size classes
+	static constexpr size_t s_chunkSize = 64 * 1024; // The size of each chunk split into nodes (64 KB)
+
+	std::array<SizeClass, s_sizeClassCount> m_sizeClasses; // The free list for each size class
+	std::vector<void*> m_chunks; // Every chunk allocated from the global heap, to be freed with the pool
+	std::mutex m_chunksMutex; // Guards the chunks, as size classes may be refilled concurrently
+};
+
+// Standard allocator that allocates from an Arena
+// Note: Containers using different arenas copy their elements when moved into each other, instead of taking the storage.
+template<typename T>
+class ArenaAllocator
+{
+public:
+	using value_type = T;
+
+	// Constructor with arena argument - the arena must outlive anything allocated from it
+	ArenaAllocator(Arena& arena) : m_arena(&arena) {}
+
+	// Conversion constructor from an allocator for another type, which uses the same arena
+	template<typename U>
+	ArenaAllocator(const ArenaAllocator<U>& other) : m_arena(other.m_arena) {}
+
+	// Equality operator - allocators using the same arena can free each other's memory
+	template<typename U>
+	bool operator==(const ArenaAllocator<U>& other) const
+	{
+		return m_arena == other.m_arena;
+	}
+
+	// Returns uninitialized memory for the given number of elements
+	T* allocate(const size_t count)
+	{
+		if (count > std::numeric_limits<size_t>::max() / sizeof(T))
+		{
+			throw std::bad_array_new_length();
+		}
+		return static_cast<T*>(m_arena->Allocate(count * sizeof(T), alignof(T)));
+	}
+
+	// Frees the memory for the given number of elements (see Arena::Deallocate)
+	void deallocate(T* data, const size_t count)
+	{
+		m_arena->Deallocate(data, count * sizeof(T));
+	}
+
+private:
+	template<typename U>
+	friend class ArenaAllocator;
+
+	Arena* m_arena; // The arena to allocate from
+};
+
+// Standard allocator that allocates from a Pool
+template<typename T>
+class PoolAllocator
+{
+public:
+	using value_type = T;
+
+	// Constructor with pool argument - the pool must outlive anything allocated from it
+	PoolAllocator(Pool& pool) : m_pool(&pool) {}
+
+	// Conversion constructor from an allocator for another type, which uses the same pool
+	template<typename U>
+	PoolAllocator(const PoolAllocator<U>& other) : m_pool(other.m_pool) {}
+
+	// Equality operator - allocators using the same pool can free each other's memory
+	template<typename U>
+	bool operator==(const PoolAllocator<U>& other) const
+	{
+		return m_pool == other.m_pool;
+	}
+
+	// Returns uninitialized memory for the given number of elements
+	T* allocate(const size_t count)
+	{
+		if (count > std::numeric_limits<size_t>::max() / sizeof(T))
+		{
+			throw std::bad_array_new_length();
+		}
+		return static_cast<T*>(m_pool->Allocate(count * sizeof(T), alignof(T)));
+	}
+
+	// Gives the memory for the given number of elements back to the pool
+	void deallocate(T* data, const size_t count)
+	{
+		m_pool->Deallocate(data, count * sizeof(T), alignof(T));
+	}
+
+private:
+	template<typename U>
+	friend class PoolAllocator;
+
+	Pool* m_pool; // The pool to allocate from
+};
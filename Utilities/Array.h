@@ -1,9 +1,12 @@
 /* 
  * Array.h
  * 
- * This custom abstract array interface provides common functionality for array data structures.
+ * This custom array base class provides common functionality for array data structures.
  * 
- * For implementations of this interface, see StaticArray.h and DynamicArray.h.
+ * Arrays derive from ArrayBase using the curiously recurring template pattern, so its algorithms call the Data() and Size() methods of the derived array directly,
+ * allowing them to be inlined and vectorized. Array is a runtime interface for code that needs to accept any kind of array, and ArrayAdapter adapts an array to it.
+ * 
+ * For implementations of this base class, see StaticArray.h, DynamicArray.h and ArrayView.h.
  *   
  * DISCLAIMER: This implementation is intended for portfolio/education purposes only.
  * For production use, it is recommended to use std::array or std::vector instead.
@@ -13,10 +16,37 @@
 
 #pragma once
 
+#include "Random.h"
+#include "Simd.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
 #include <concepts>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
 #include <type_traits>
+#include <utility>
+#include <vector>
+
+// Enum for specifying whether an algorithm runs on the calling thread only (sequential) or is split across worker threads (parallel)
+// Parallel unsequenced algorithms may also process the elements within each thread in any order, so they can evaluate predicates without branching on each result.
+enum class ExecutionPolicy
+{
+	Sequential,
+	Parallel,
+	ParallelUnsequenced
+};
 
 // Enum for specifying the sort order (ascending or descending)
 enum class SortOrder
@@ -25,92 +55,262 @@ enum class SortOrder
 	Descending
 };
 
-template<typename T>
-class Array
+// Enum for specifying how indices and ranges are checked against the bounds of an array
+// Checked throws std::out_of_range, DebugOnly asserts so that the check is removed from release builds, and Unchecked makes no check at all.
+enum class BoundsChecking
 {
-public:
-	// Default constructor
-	Array() = default;
+	Checked,
+	DebugOnly,
+	Unchecked
+};
 
-	// Default destructor
-	virtual ~Array() = default;
+// Enum for the kinds of stages in a lazy pipeline (see LazyArray.h), which determines how the pipeline can be run
+// Map pipelines have exactly one result per element, Filter pipelines may drop elements, and Take pipelines stop after a number of filtered results so must run in order.
+enum class LazyStages
+{
+	Map,
+	Filter,
+	Take
+};
+
+// The bounds checking used by the index operator and the range methods of arrays, which is Checked unless ARRAY_BOUNDS_CHECKING is defined before including this file
+// Note: ARRAY_BOUNDS_CHECKING must be the same in every translation unit (e.g. define it for the whole project). At() is always checked and Unchecked() never is, regardless of this setting.
+#if !defined(ARRAY_BOUNDS_CHECKING)
+#define ARRAY_BOUNDS_CHECKING Checked
+#endif
+
+template<typename T>
+class ArrayView;
 
+template<typename T, typename Allocator = std::allocator<T>, size_t InlineCapacity = 0>
+class DynamicArray;
+
+template<typename T, typename U, typename Chain, LazyStages Stages>
+class LazyArray;
+
+template<typename T>
+class Array;
+
+template<typename T, typename Derived>
+class ArrayAdapter;
+
+template<typename T, typename Derived>
+class ArrayBase
+{
+public:
 	// Index operator
-	T& operator[](const size_t index)
+	constexpr T& operator[](const size_t index)
 	{
 		BoundsCheck(index);
-		return Data()[index];
+		return Self().Data()[index];
 	}
 
 	// Index operator (const version)
-	const T& operator[](const size_t index) const
+	constexpr const T& operator[](const size_t index) const
 	{
-		return const_cast<Array<T>*>(this)->operator[](index);
+		return const_cast<ArrayBase*>(this)->operator[](index);
 	}
 
 	// Equality operator
-	bool operator==(const Array& other) const
+	template<typename OtherDerived>
+	constexpr bool operator==(const ArrayBase<T, OtherDerived>& other) const
 	{
 		return Equals(other.Data(), other.Size());
 	}
 
 	// Equality operator with c-style array
 	template <size_t M>
-	bool operator==(const T(&other)[M]) const
+	constexpr bool operator==(const T(&other)[M]) const
 	{
 		return Equals(other, M);
 	}
 
 	// Inequality operator
-	bool operator!=(const Array& other) const
+	template<typename OtherDerived>
+	constexpr bool operator!=(const ArrayBase<T, OtherDerived>& other) const
 	{
 		return !(*this == other);
 	}
 
 	// Inequality operator with c-style array
 	template <size_t M>
-	bool operator!=(const T(&other)[M]) const
+	constexpr bool operator!=(const T(&other)[M]) const
 	{
 		return !(*this == other);
 	}
 
 	// Range-based for loop support
-	T* begin()
+	constexpr T* begin()
+	{
+		return Self().Data();
+	}
+
+	constexpr T* end()
+	{
+		return Self().Data() + Self().Size();
+	}
+
+	constexpr const T* begin() const
+	{
+		return const_cast<ArrayBase*>(this)->begin();
+	}
+
+	constexpr const T* end() const
 	{
-		return Data();
+		return const_cast<ArrayBase*>(this)->end();
+	}
+
+	// Returns the element at the specified index, which is always checked to be within bounds
+	constexpr T& At(const size_t index)
+	{
+		CheckedBoundsCheck(index);
+		return Self().Data()[index];
+	}
+
+	// Returns the element at the specified index, which is always checked to be within bounds (const version)
+	constexpr const T& At(const size_t index) const
+	{
+		return const_cast<ArrayBase*>(this)->At(index);
+	}
+
+	// Finds the lower bound of each of the given values within the sorted range (see LowerBound), which must be in either ascending (default) or descending order, and writes the indices to the output array
+	void BatchLowerBound(const T* values, const size_t count, size_t* indices, const SortOrder order = SortOrder::Ascending, const size_t from = 0, const size_t to = s_maxSize) const
+	{
+		if (order == SortOrder::Ascending)
+		{
+			BatchLowerBound(values, count, indices, OrderPredicate<SortOrder::Ascending>(), from, to);
+		}
+		else
+		{
+			BatchLowerBound(values, count, indices, OrderPredicate<SortOrder::Descending>(), from, to);
+		}
+	}
+
+	// Finds the lower bound of each of the given values within the range sorted based on the given predicate (see LowerBound), and writes the indices to the output array
+	// Note: The searches are interleaved in groups, with each one prefetching its next probe while the others run, so their cache misses overlap instead of being paid one at a time.
+	template<typename Predicate>
+	void BatchLowerBound(const T* values, const size_t count, size_t* indices, const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize) const
+	{
+		if (Self().Size() == 0)
+		{
+			std::fill(indices, indices + count, size_t{ 0 });
+			return;
+		}
+
+		const size_t size = RangeEnd(from, to);
+		if (size <= from)
+		{
+			std::fill(indices, indices + count, from);
+			return;
+		}
+
+		SearchBounds<false>(predicate, Self().Data() + from, size - from, values, count, indices);
+		for (size_t i = 0; i < count; ++i)
+		{
+			indices[i] += from;
+		}
+	}
+
+	// Finds the upper bound of each of the given values within the sorted range (see UpperBound), which must be in either ascending (default) or descending order, and writes the indices to the output array
+	void BatchUpperBound(const T* values, const size_t count, size_t* indices, const SortOrder order = SortOrder::Ascending, const size_t from = 0, const size_t to = s_maxSize) const
+	{
+		if (order == SortOrder::Ascending)
+		{
+			BatchUpperBound(values, count, indices, OrderPredicate<SortOrder::Ascending>(), from, to);
+		}
+		else
+		{
+			BatchUpperBound(values, count, indices, OrderPredicate<SortOrder::Descending>(), from, to);
+		}
 	}
 
-	T* end()
+	// Finds the upper bound of each of the given values within the range sorted based on the given predicate (see UpperBound), and writes the indices to the output array
+	// Note: The searches are interleaved in groups, with each one prefetching its next probe while the others run, so their cache misses overlap instead of being paid one at a time.
+	template<typename Predicate>
+	void BatchUpperBound(const T* values, const size_t count, size_t* indices, const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize) const
 	{
-		return Data() + Size();
+		if (Self().Size() == 0)
+		{
+			std::fill(indices, indices + count, size_t{ 0 });
+			return;
+		}
+
+		const size_t size = RangeEnd(from, to);
+		if (size <= from)
+		{
+			std::fill(indices, indices + count, from);
+			return;
+		}
+
+		SearchBounds<true>(predicate, Self().Data() + from, size - from, values, count, indices);
+		for (size_t i = 0; i < count; ++i)
+		{
+			indices[i] += from;
+		}
 	}
 
-	const T* begin() const
+	// Returns the index of the first occurrence of the given value within the sorted range, which must be in either ascending (default) or descending order, or the array size if not found
+	size_t BinarySearch(const T& value, const SortOrder order = SortOrder::Ascending, const size_t from = 0, const size_t to = s_maxSize) const
 	{
-		return const_cast<Array<T>*>(this)->begin();
+		if (order == SortOrder::Ascending)
+		{
+			return BinarySearch(value, OrderPredicate<SortOrder::Ascending>(), from, to);
+		}
+		return BinarySearch(value, OrderPredicate<SortOrder::Descending>(), from, to);
 	}
 
-	const T* end() const
+	// Returns the index of the first element within the range sorted based on the given predicate that is equivalent to the given value, or the array size if not found
+	// Note: Elements are equivalent if neither is ordered before the other.
+	template<typename Predicate>
+	size_t BinarySearch(const T& value, const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize) const
 	{
-		return const_cast<Array<T>*>(this)->end();
+		if (Self().Size() == 0)
+		{
+			return Self().Size();
+		}
+
+		const size_t size = RangeEnd(from, to);
+		if (size <= from)
+		{
+			return Self().Size();
+		}
+
+		const size_t index = from + SearchBound<false>(predicate, Self().Data() + from, size - from, value);
+		return (index < size && !predicate(value, Self().Data()[index])) ? index : Self().Size();
 	}
 
 	// Returns true if the array contains the given value
-	bool Contains(const T& value, const size_t from = 0, const size_t to = s_maxSize) const
+	// Note: Arithmetic element types are searched using vectorized instructions.
+	constexpr bool Contains(const T& value, const size_t from = 0, const size_t to = s_maxSize) const
 	{
+		if constexpr (Simd::Arithmetic<T>)
+		{
+			return IndexOf(value, from, to) != Self().Size();
+		}
 		return Find([&](const T& element) { return element == value; }, from, to);
 	}
 
 	// Deep copies the elements from the raw array
 	// Note: Remaining elements are left uninitialized.
-	virtual bool Copy(const T* data, const size_t size, const size_t offset = 0)
+	constexpr bool Copy(const T* data, const size_t size, const size_t offset = 0)
 	{
-		return CopyOrMove(data, size, Data(), Bounds(), offset);
+		return CopyOrMove(data, size, Self().Data(), Self().Bounds(), offset);
 	}
 
 	// Returns the number of occurrences of the given value in the array
+	// Note: Arithmetic element types are searched using vectorized instructions.
 	size_t Count(const T& value, const size_t from = 0, const size_t to = s_maxSize) const
 	{
+		if constexpr (Simd::Arithmetic<T>)
+		{
+			if (Self().Size() == 0)
+			{
+				return 0;
+			}
+
+			const size_t size = RangeEnd(from, to);
+			return (size > from) ? Simd::Count(Self().Data() + from, size - from, value) : 0;
+		}
 		return Count([&](const T& element) { return element == value; }, from, to);
 	}
 
@@ -124,19 +324,19 @@ public:
 	template<typename Predicate>
 	size_t Count(const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize) const
 	{
-		if (Size() == 0)
+		if (Self().Size() == 0)
 		{
 			return 0;
 		}
 
 		BoundsCheck(from);
-		const size_t size = (to == s_maxSize) ? Size() : to;
+		const size_t size = (to == s_maxSize) ? Self().Size() : to;
 		BoundsCheck(size - 1);
 
 		size_t count = 0;
 		for (size_t i = from; i < size; ++i)
 		{
-			if (predicate(Data()[i]))
+			if (predicate(Self().Data()[i]))
 			{
 				++count;
 			}
@@ -144,11 +344,63 @@ public:
 		return count;
 	}
 
+	// Returns the number of occurrences of the given value in the array using the given execution policy
+	// Note: A sequential count will be used instead for small arrays.
+	size_t Count(const ExecutionPolicy policy, const T& value, const size_t from = 0, const size_t to = s_maxSize) const
+	{
+		if (Self().Size() == 0)
+		{
+			return 0;
+		}
+
+		const size_t size = RangeEnd(from, to);
+		std::atomic<size_t> count = 0;
+		ParallelFor(policy, from, size, false, [&](const size_t chunkFrom, const size_t chunkTo)
+		{
+			count.fetch_add(Count(value, chunkFrom, chunkTo), std::memory_order_relaxed);
+			return true;
+		});
+		return count;
+	}
+
+	// Returns the number of occurrences of nullptr in the array using the given execution policy
+	size_t Count(const ExecutionPolicy policy, std::nullptr_t, const size_t from = 0, const size_t to = s_maxSize) const
+	{
+		return Count(policy, [](const T& element) { return element == nullptr; }, from, to);
+	}
+
+	// Returns the number of elements in the array that satisfy the predicate using the given execution policy
+	// Note: A sequential count will be used instead for small arrays. The predicate must be safe to call from multiple threads.
+	template<typename Predicate>
+	size_t Count(const ExecutionPolicy policy, const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize) const
+	{
+		if (Self().Size() == 0)
+		{
+			return 0;
+		}
+
+		const size_t size = RangeEnd(from, to);
+		std::atomic<size_t> count = 0;
+		ParallelFor(policy, from, size, false, [&](const size_t chunkFrom, const size_t chunkTo)
+		{
+			count.fetch_add(Count(predicate, chunkFrom, chunkTo), std::memory_order_relaxed);
+			return true;
+		});
+		return count;
+	}
+
 	// Returns a pointer to the first element of the array
-	virtual T* Data() = 0;
+	// Note: Derived arrays provide this method, which hides this version. It allows the pointer to be taken through a reference to this class.
+	constexpr T* Data()
+	{
+		return Self().Data();
+	}
 
 	// Returns a pointer to the first element of the array (const version)
-	virtual const T* Data() const = 0;
+	constexpr const T* Data() const
+	{
+		return Self().Data();
+	}
 
 	// Deletes all elements in the array
 	// Note: Non-pointer elements will automatically be removed instead.
@@ -162,472 +414,2550 @@ public:
 				delete element;
 				element = nullptr;
 			}
-			dirty = Size() > 0;
+			dirty = Self().Size() > 0;
+		}
+		return Self().RemoveAll() || dirty;
+	}
+
+	// Returns the lower and upper bounds of the given value within the sorted range, which must be in either ascending (default) or descending order
+	std::pair<size_t, size_t> EqualRange(const T& value, const SortOrder order = SortOrder::Ascending, const size_t from = 0, const size_t to = s_maxSize) const
+	{
+		if (order == SortOrder::Ascending)
+		{
+			return EqualRange(value, OrderPredicate<SortOrder::Ascending>(), from, to);
+		}
+		return EqualRange(value, OrderPredicate<SortOrder::Descending>(), from, to);
+	}
+
+	// Returns the lower and upper bounds of the given value within the range sorted based on the given predicate, so the elements equivalent to the value are between them
+	// Note: The upper bound is only searched for from the lower bound onwards.
+	template<typename Predicate>
+	std::pair<size_t, size_t> EqualRange(const T& value, const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize) const
+	{
+		if (Self().Size() == 0)
+		{
+			return { 0, 0 };
 		}
-		return RemoveAll() || dirty;
+
+		const size_t size = RangeEnd(from, to);
+		if (size <= from)
+		{
+			return { from, from };
+		}
+
+		const size_t lower = from + SearchBound<false>(predicate, Self().Data() + from, size - from, value);
+		return { lower, lower + SearchBound<true>(predicate, Self().Data() + lower, size - lower, value) };
 	}
 
 	// Equality comparison with raw array
-	bool Equals(const T* data, const size_t size) const
+	constexpr bool Equals(const T* data, const size_t size) const
 	{
-		return Equals(Data(), Size(), data, size);
+		return Equals(Self().Data(), Self().Size(), data, size);
 	}
 
 	// Fills the array with the given value
 	// Note: Remaining elements are left uninitialized.
-	virtual bool Fill(const T& value = T{}, const size_t from = 0, const size_t to = s_maxSize)
+	constexpr bool Fill(const T& value = T{}, const size_t from = 0, const size_t to = s_maxSize)
 	{
-		if (Bounds() == 0)
+		if (Self().Bounds() == 0)
 		{
 			return false;
 		}
 
 		BoundsCheck(from);
-		const size_t size = (to == s_maxSize) ? Bounds() : to;
+		const size_t size = (to == s_maxSize) ? Self().Bounds() : to;
 		BoundsCheck(size - 1);
 
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				Simd::Fill(Self().Data() + from, size - from, value);
+				return (size - from) > 0;
+			}
+		}
+
 		for (size_t i = from; i < size; ++i)
 		{
-			Data()[i] = value;
+			Self().Data()[i] = value;
+		}
+		return (size - from) > 0;
+	}
+
+	// Fills the array with the given value using the given execution policy
+	// Note: Remaining elements are left uninitialized. A sequential fill will be used instead for small arrays.
+	bool Fill(const ExecutionPolicy policy, const T& value = T{}, const size_t from = 0, const size_t to = s_maxSize)
+	{
+		if (Self().Bounds() == 0)
+		{
+			return false;
 		}
+
+		BoundsCheck(from);
+		const size_t size = (to == s_maxSize) ? Self().Bounds() : to;
+		BoundsCheck(size - 1);
+
+		// Calls the base version directly, as derived versions may also resize the array, which is not safe from multiple threads
+		ParallelFor(policy, from, size, false, [&](const size_t chunkFrom, const size_t chunkTo)
+		{
+			return ArrayBase::Fill(value, chunkFrom, chunkTo);
+		});
 		return (size - from) > 0;
 	}
 
 	// Returns a pointer to the first element in the array that satisfies the predicate, or nullptr if not found
 	template<typename Predicate>
-	const T* Find(const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize) const
+	constexpr const T* Find(const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize) const
 	{
-		if (Size() == 0)
+		if (Self().Size() == 0)
 		{
 			return nullptr;
 		}
 
 		BoundsCheck(from);
-		const size_t size = (to == s_maxSize) ? Size() : to;
+		const size_t size = (to == s_maxSize) ? Self().Size() : to;
 		BoundsCheck(size - 1);
 
 		for (size_t i = from; i < size; ++i)
 		{
-			if (predicate(Data()[i]))
+			if (predicate(Self().Data()[i]))
 			{
-				return &Data()[i];
+				return &Self().Data()[i];
 			}
 		}
 		return nullptr;
 	}
 
+	// Returns a pointer to the first element in the array that satisfies the predicate using the given execution policy, or nullptr if not found
+	// Note: The predicate must be safe to call from multiple threads (see IndexOf).
+	template<typename Predicate>
+	const T* Find(const ExecutionPolicy policy, const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize) const
+	{
+		const size_t index = IndexOf(policy, predicate, from, to);
+		return (index != Self().Size()) ? &Self().Data()[index] : nullptr;
+	}
+
 	// Returns the index of the first occurrence of the given value in the array, or the array size if not found
-	size_t IndexOf(const T& value, const size_t from = 0, const size_t to = s_maxSize) const
+	// Note: Arithmetic element types are searched using vectorized instructions, except in constant expressions.
+	constexpr size_t IndexOf(const T& value, const size_t from = 0, const size_t to = s_maxSize) const
 	{
+		if constexpr (Simd::Arithmetic<T>)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				if (Self().Size() == 0)
+				{
+					return Self().Size();
+				}
+
+				const size_t size = RangeEnd(from, to);
+				if (size <= from)
+				{
+					return Self().Size();
+				}
+				const size_t index = Simd::IndexOf(Self().Data() + from, size - from, value);
+				return (index < size - from) ? from + index : Self().Size();
+			}
+		}
 		return IndexOf([&](const T& element) { return element == value; }, from, to);
 	}
 
 	// Returns the index of the first occurrence of nullptr in the array, or the array size if not found
-	size_t IndexOf(std::nullptr_t, const size_t from = 0, const size_t to = s_maxSize) const
+	constexpr size_t IndexOf(std::nullptr_t, const size_t from = 0, const size_t to = s_maxSize) const
 	{
 		return IndexOf([](const T& element) { return element == nullptr; }, from, to);
 	}
 
 	// Returns the index of the first element in the array that satisfies the predicate, or the array size if not found
 	template<typename Predicate>
-	size_t IndexOf(const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize) const
+	constexpr size_t IndexOf(const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize) const
 	{
-		if (Size() == 0)
+		if (Self().Size() == 0)
 		{
-			return Size();
+			return Self().Size();
 		}
 
 		BoundsCheck(from);
-		const size_t size = (to == s_maxSize) ? Size() : to;
+		const size_t size = (to == s_maxSize) ? Self().Size() : to;
 		BoundsCheck(size - 1);
 
 		for (size_t i = from; i < size; ++i)
 		{
-			if (predicate(Data()[i]))
+			if (predicate(Self().Data()[i]))
 			{
 				return i;
 			}
 		}
-		return Size();
-	}
-
-	// Moves the elements from the raw array
-	// Note: Remaining elements are left uninitialized.
-	virtual bool Move(T* data, const size_t size, const size_t offset = 0)
-	{
-		return CopyOrMove(data, size, Data(), Bounds(), offset, true);
+		return Self().Size();
 	}
 
-	// Removes all elements from the array
-	virtual bool RemoveAll() = 0;
-
-	// Replaces all occurrences of the old value in the array with the new value
-	bool Replace(const T& oldValue, const T& newValue, const size_t from = 0, const size_t to = s_maxSize)
+	// Returns the index of the first occurrence of the given value in the array using the given execution policy, or the array size if not found
+	// Note: A sequential search will be used instead for small arrays.
+	size_t IndexOf(const ExecutionPolicy policy, const T& value, const size_t from = 0, const size_t to = s_maxSize) const
 	{
-		if (oldValue == newValue)
+		if constexpr (Simd::Arithmetic<T>)
 		{
-			return false;
-		}
+			if (Self().Size() == 0)
+			{
+				return Self().Size();
+			}
 
-		return Replace([&](const T& element) { return element == oldValue; }, newValue, from, to);
+			const size_t size = RangeEnd(from, to);
+			std::atomic<size_t> found = Self().Size();
+			ParallelFor(policy, from, size, true, [&](const size_t chunkFrom, const size_t chunkTo)
+			{
+				return !FoundIndex(found, IndexOf(value, chunkFrom, chunkTo));
+			});
+			return found;
+		}
+		return IndexOf(policy, [&](const T& element) { return element == value; }, from, to);
 	}
 
-	// Replaces all occurrences of nullptr in the array with the new value
-	bool Replace(std::nullptr_t, const T& newValue, const size_t from = 0, const size_t to = s_maxSize)
+	// Returns the index of the first occurrence of nullptr in the array using the given execution policy, or the array size if not found
+	size_t IndexOf(const ExecutionPolicy policy, std::nullptr_t, const size_t from = 0, const size_t to = s_maxSize) const
 	{
-		if (newValue == nullptr)
-		{
-			return false;
-		}
-
-		return Replace([](const T& element) { return element == nullptr; }, newValue, from, to);
+		return IndexOf(policy, [](const T& element) { return element == nullptr; }, from, to);
 	}
 
-	// Replaces all elements in the array that satisfy the predicate with the new value
+	// Returns the index of the first element in the array that satisfies the predicate using the given execution policy, or the array size if not found
+	// Note: Chunks are searched in ascending order and none are started after a match is found, so the lowest matching index is still returned. The predicate must be safe to call from multiple threads.
 	template<typename Predicate>
-	bool Replace(const Predicate& predicate, const T& newValue, const size_t from = 0, const size_t to = s_maxSize)
+	size_t IndexOf(const ExecutionPolicy policy, const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize) const
 	{
-		if (Size() == 0)
+		if (Self().Size() == 0)
 		{
-			return false;
+			return Self().Size();
 		}
-		
-		BoundsCheck(from);
-		const size_t size = (to == s_maxSize) ? Size() : to;
-		BoundsCheck(size - 1);
 
-		bool dirty = false;
-		for (size_t i = from; i < size; ++i)
+		const size_t size = RangeEnd(from, to);
+		std::atomic<size_t> found = Self().Size();
+		ParallelFor(policy, from, size, true, [&](const size_t chunkFrom, const size_t chunkTo)
 		{
-			if (predicate(Data()[i]))
+			if (policy == ExecutionPolicy::ParallelUnsequenced)
 			{
-				Data()[i] = newValue;
-				dirty = true;
+				const size_t index = IndexOfUnsequenced(predicate, Self().Data() + chunkFrom, chunkTo - chunkFrom);
+				return !FoundIndex(found, (index < chunkTo - chunkFrom) ? chunkFrom + index : Self().Size());
 			}
-		}
-		return dirty;
+			return !FoundIndex(found, IndexOf(predicate, chunkFrom, chunkTo));
+		});
+		return found;
 	}
 
-	// Reverses the order of elements in the array
-	bool Reverse() 
+	// Returns a lazy pipeline over the elements within the specified range, to which stages such as Filter, Map and Take can be added without creating intermediate arrays
+	// Note: LazyArray.h must be included to use this method. The stages are fused into a single pass over the elements when the results are counted or collected.
+	LazyArray<T, T, std::identity, LazyStages::Map> Lazy(const size_t from = 0, const size_t to = s_maxSize) const
 	{
-		size_t first = 0;
-		size_t last = Size() - 1;
-		while (first < last)
+		const size_t size = SliceEnd(from, to);
+		return LazyArray<T, T, std::identity, LazyStages::Map>(Self().Data() + (size > from ? from : 0), size > from ? size - from : 0, std::identity());
+	}
+
+	// Returns the index of the first element within the sorted range that is not ordered before the given value, which must be in either ascending (default) or descending order, or the end of the range if there is none
+	size_t LowerBound(const T& value, const SortOrder order = SortOrder::Ascending, const size_t from = 0, const size_t to = s_maxSize) const
+	{
+		if (order == SortOrder::Ascending)
 		{
-			Swap(first, last);
-			++first;
-			--last;
+			return LowerBound(value, OrderPredicate<SortOrder::Ascending>(), from, to);
 		}
-		return Size() > 0;
+		return LowerBound(value, OrderPredicate<SortOrder::Descending>(), from, to);
 	}
 
-	// Returns a pointer to the last element in the array that satisfies the predicate, or nullptr if not found
+	// Returns the index of the first element within the range sorted based on the given predicate that is not ordered before the given value, or the end of the range if there is none
+	// Note: A branchless binary search is used, which also prefetches both of the possible next elements for large arrays, so the worst case is O(log n).
 	template<typename Predicate>
-	const T* ReverseFind(const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize) const
+	size_t LowerBound(const T& value, const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize) const
 	{
-		if (Size() == 0)
+		if (Self().Size() == 0)
 		{
-			return nullptr;
+			return 0;
 		}
 
-		BoundsCheck(from);
-		const size_t size = (to == s_maxSize) ? Size() : to;
-		BoundsCheck(size - 1);
-
-		for (size_t i = size - 1; i > from; --i)
+		const size_t size = RangeEnd(from, to);
+		if (size <= from)
 		{
-			if (predicate(Data()[i]))
-			{
-				return &Data()[i];
-			}
+			return from;
 		}
-		return nullptr;
+
+		return from + SearchBound<false>(predicate, Self().Data() + from, size - from, value);
 	}
 
-	// Returns the index of the last occurrence of the given value in the array, or the array size if not found
-	size_t ReverseIndexOf(const T& value, const size_t from = 0, const size_t to = s_maxSize) const
+	// Moves the elements from the raw array
+	// Note: Remaining elements are left uninitialized.
+	constexpr bool Move(T* data, const size_t size, const size_t offset = 0)
 	{
-		return ReverseIndexOf([&](const T& element) { return element == value; }, from, to);
+		return CopyOrMove(data, size, Self().Data(), Self().Bounds(), offset, true);
 	}
 
-	// Returns the index of the last occurrence of nullptr in the array, or the array size if not found
-	size_t ReverseIndexOf(std::nullptr_t, const size_t from = 0, const size_t to = s_maxSize) const
+	// Rearranges the elements so that the element at the given index is the one that would be there if the range was sorted in ascending (default) or descending order
+	// Note: Elements before the index are not ordered after it and elements after it are not ordered before it, but are otherwise left in no particular order.
+	bool NthElement(const size_t index, const SortOrder order = SortOrder::Ascending, const size_t from = 0, const size_t to = s_maxSize)
 	{
-		return ReverseIndexOf([](const T& element) { return element == nullptr; }, from, to);
+		if (order == SortOrder::Ascending)
+		{
+			return NthElement(index, OrderPredicate<SortOrder::Ascending>(), from, to);
+		}
+		return NthElement(index, OrderPredicate<SortOrder::Descending>(), from, to);
 	}
 
-	// Returns the index of the last element in the array that satisfies the predicate, or the array size if not found
+	// Rearranges the elements so that the element at the given index is the one that would be there if the range was sorted based on the given predicate
+	// Note: An introspective selection is used, which falls back to a median of medians pivot if partitioning degrades, so the worst case is O(n).
 	template<typename Predicate>
-	size_t ReverseIndexOf(const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize) const
+	bool NthElement(const size_t index, const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize)
 	{
-		if (Size() == 0)
+		if (Self().Size() == 0)
 		{
-			return Size();
+			return false;
 		}
 
 		BoundsCheck(from);
-		const size_t size = (to == s_maxSize) ? Size() : to;
-		BoundsCheck(size - 1);
+		const size_t size = (to == s_maxSize) ? Self().Size() - 1 : to;
+		BoundsCheck(size);
 
-		for (size_t i = size - 1; i > from; --i)
+		if (index < from || index > size)
 		{
-			if (predicate(Data()[i]))
-			{
-				return i;
-			}
+			throw std::out_of_range("Array index out of bounds");
 		}
-		return Size();
-	}
 
+		return Select(predicate, from, size, index);
+	}
 
-	// Randomly shuffles the array using a Fisher-Yates algorithm 
-	// Note: Make sure to seed the random number generator (e.g. using srand) before calling this method to ensure proper randomness.
-	bool Shuffle()
+	// Sorts the given number of elements at the start of the range in either ascending (default) or descending order, leaving the remaining elements in no particular order
+	bool PartialSort(const size_t count, const SortOrder order = SortOrder::Ascending, const size_t from = 0, const size_t to = s_maxSize)
 	{
-		for (size_t i = 0; i < Size() - 1; ++i)
+		if (order == SortOrder::Ascending)
 		{
-			size_t j = i + rand() % (Size() - i);
-			Swap(i, j);
+			return PartialSort(count, OrderPredicate<SortOrder::Ascending>(), from, to);
 		}
-		return Size() > 0;
-	}
-
-	// Returns the size of the array
-	virtual const size_t Size() const = 0;
-
-	// Sorts the elements of the array using a quick sort algorithm in either ascending (default) or descending order
-	// Note: An insertion sort will be used instead for small arrays.
-	bool Sort(const SortOrder order = SortOrder::Ascending, const size_t from = 0, const size_t to = s_maxSize, const size_t insertionSortThreshold = s_defaultInsertionSortThreshold)
-	{
-		return Sort([order](const T& a, const T& b) { return order == SortOrder::Ascending ? a < b : a > b; }, from, to, insertionSortThreshold);
+		return PartialSort(count, OrderPredicate<SortOrder::Descending>(), from, to);
 	}
 
-	// Sorts the elements of the array using a quick sort algorithm based on the given predicate
-	// Note: An insertion sort will be used instead for small arrays.
+	// Sorts the given number of elements at the start of the range based on the given predicate, leaving the remaining elements in no particular order
+	// Note: The elements are selected first, using a bounded heap for small counts or in linear time otherwise, so that only they need to be sorted.
 	template<typename Predicate>
-	bool Sort(const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize, const size_t insertionSortThreshold = s_defaultInsertionSortThreshold)
+	bool PartialSort(const size_t count, const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize)
 	{
-		if (Size() == 0)
+		if (Self().Size() == 0 || count == 0)
 		{
 			return false;
 		}
 
 		BoundsCheck(from);
-		const size_t size = (to == s_maxSize) ? Size() - 1 : to;
+		const size_t size = (to == s_maxSize) ? Self().Size() - 1 : to;
 		BoundsCheck(size);
 
-		return QuickSort(predicate, from, size, insertionSortThreshold);
-	}
-
-	// Swaps the elements at the given indices
-	bool Swap(const size_t index1, const size_t index2)
-	{
-		if (index1 == index2)
+		if (count > size - from)
 		{
-			return false;
+			return IntroSort(predicate, from, size, s_defaultInsertionSortThreshold, SortDepthLimit(size - from + 1));
 		}
-		BoundsCheck(index1);
-		BoundsCheck(index2);
 
-		const T temp = std::move(Data()[index1]);
-		Data()[index1] = std::move(Data()[index2]);
-		Data()[index2] = std::move(temp);
+		// For small counts, keeps a max heap of the elements that would come first, so the heap's first element is the one to replace
+		if (count <= (size - from + 1) / s_heapSelectRatio)
+		{
+			T* const data = Self().Data() + from;
+			for (size_t i = count / 2; i > 0; --i)
+			{
+				SiftDown(predicate, data, i - 1, count);
+			}
+			for (size_t i = count; i <= size - from; ++i)
+			{
+				if (predicate(data[i], data[0]))
+				{
+					std::swap(data[i], data[0]);
+					SiftDown(predicate, data, 0, count);
+				}
+			}
+			return HeapSort(predicate, from, from + count - 1) || count > 1;
+		}
 
-		return true;
+		const size_t last = from + count - 1;
+		bool dirty = Select(predicate, from, size, last);
+		if (last > from)
+		{
+			dirty = IntroSort(predicate, from, last - 1, s_defaultInsertionSortThreshold, SortDepthLimit(count - 1)) || dirty;
+		}
+		return dirty;
 	}
 
-protected:
-	// Returns the maximum size of the array
-	static constexpr size_t MaxSize()
+	// Replaces all occurrences of the old value in the array with the new value
+	bool Replace(const T& oldValue, const T& newValue, const size_t from = 0, const size_t to = s_maxSize)
 	{
-		return s_maxSize;
+		if (oldValue == newValue)
+		{
+			return false;
+		}
+
+		return Replace([&](const T& element) { return element == oldValue; }, newValue, from, to);
 	}
 
-	// Throws an exception if the index is out of bounds
-	void BoundsCheck(const size_t index) const
+	// Replaces all occurrences of nullptr in the array with the new value
+	bool Replace(std::nullptr_t, const T& newValue, const size_t from = 0, const size_t to = s_maxSize)
 	{
-		if (index >= Bounds())
+		if (newValue == nullptr)
 		{
-			throw std::out_of_range("Array index out of bounds");
+			return false;
 		}
+
+		return Replace([](const T& element) { return element == nullptr; }, newValue, from, to);
 	}
 
-private:
-	// Copies or moves the elements from the source array into the destination array
-	static bool CopyOrMove(T* source, const size_t sourceSize, T* destination, const size_t destinationSize, const size_t offset = 0, bool move = false)
+	// Replaces all elements in the array that satisfy the predicate with the new value
+	template<typename Predicate>
+	bool Replace(const Predicate& predicate, const T& newValue, const size_t from = 0, const size_t to = s_maxSize)
 	{
-		if (!Equals(source, sourceSize, destination, destinationSize)) // Check for self-assignment
+		if (Self().Size() == 0)
 		{
-			if (destinationSize < sourceSize + offset)
-			{
-				throw std::length_error("Destination array cannot be smaller than source array");
-			}
+			return false;
+		}
+		
+		BoundsCheck(from);
+		const size_t size = (to == s_maxSize) ? Self().Size() : to;
+		BoundsCheck(size - 1);
 
-			for (size_t i = 0; i < sourceSize; ++i)
+		bool dirty = false;
+		for (size_t i = from; i < size; ++i)
+		{
+			if (predicate(Self().Data()[i]))
 			{
-				destination[i + offset] = move ? std::move(source[i]) : source[i];
+				Self().Data()[i] = newValue;
+				dirty = true;
 			}
-			return sourceSize > 0;
 		}
-		return false;
+		return dirty;
 	}
 
-	// Copies or moves the elements from the source array into the destination array
-	static bool CopyOrMove(const T* source, const size_t sourceSize, T* destination, const size_t destinationSize, const size_t offset = 0)
+	// Replaces all occurrences of the old value in the array with the new value using the given execution policy
+	// Note: A sequential replace will be used instead for small arrays.
+	bool Replace(const ExecutionPolicy policy, const T& oldValue, const T& newValue, const size_t from = 0, const size_t to = s_maxSize)
 	{
-		return CopyOrMove(const_cast<T*>(source), sourceSize, destination, destinationSize, offset);
+		if (oldValue == newValue)
+		{
+			return false;
+		}
+
+		return Replace(policy, [&](const T& element) { return element == oldValue; }, newValue, from, to);
 	}
 
-	// Returns whether two raw arrays are equal
-	static bool Equals(const T* left, const size_t leftSize, const T* right, const size_t rightSize)
+	// Replaces all occurrences of nullptr in the array with the new value using the given execution policy
+	bool Replace(const ExecutionPolicy policy, std::nullptr_t, const T& newValue, const size_t from = 0, const size_t to = s_maxSize)
 	{
-		if (leftSize != rightSize)
+		if (newValue == nullptr)
 		{
 			return false;
 		}
 
-		if constexpr (std::equality_comparable<T>)
+		return Replace(policy, [](const T& element) { return element == nullptr; }, newValue, from, to);
+	}
+
+	// Replaces all elements in the array that satisfy the predicate with the new value using the given execution policy
+	// Note: A sequential replace will be used instead for small arrays. The predicate must be safe to call from multiple threads.
+	template<typename Predicate>
+	bool Replace(const ExecutionPolicy policy, const Predicate& predicate, const T& newValue, const size_t from = 0, const size_t to = s_maxSize)
+	{
+		if (Self().Size() == 0)
 		{
-			for (size_t i = 0; i < leftSize; ++i)
+			return false;
+		}
+
+		const size_t size = RangeEnd(from, to);
+		std::atomic<bool> dirty = false;
+		ParallelFor(policy, from, size, false, [&](const size_t chunkFrom, const size_t chunkTo)
+		{
+			const bool chunkDirty = (policy == ExecutionPolicy::ParallelUnsequenced)
+				? ReplaceUnsequenced(predicate, Self().Data() + chunkFrom, chunkTo - chunkFrom, newValue)
+				: Replace(predicate, newValue, chunkFrom, chunkTo);
+			if (chunkDirty)
 			{
-				if (left[i] != right[i])
-				{
-					return false;
-				}
+				dirty.store(true, std::memory_order_relaxed);
 			}
 			return true;
+		});
+		return dirty;
+	}
+
+	// Reverses the order of elements in the array
+	constexpr bool Reverse()
+	{
+		if (Self().Size() == 0)
+		{
+			return false;
 		}
-		else
+
+		size_t first = 0;
+		size_t last = Self().Size() - 1;
+		while (first < last)
 		{
-			return std::memcmp(left, right, leftSize * sizeof(T)) == 0;
+			Swap(first, last);
+			++first;
+			--last;
 		}
+		return true;
 	}
 
-	// The index used for bounds checks
-	virtual size_t Bounds() const
+	// Returns a pointer to the last element in the array that satisfies the predicate, or nullptr if not found
+	template<typename Predicate>
+	const T* ReverseFind(const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize) const
+	{
+		if (Self().Size() == 0)
+		{
+			return nullptr;
+		}
+
+		BoundsCheck(from);
+		const size_t size = (to == s_maxSize) ? Self().Size() : to;
+		BoundsCheck(size - 1);
+
+		for (size_t i = size; i > from; --i)
+		{
+			if (predicate(Self().Data()[i - 1]))
+			{
+				return &Self().Data()[i - 1];
+			}
+		}
+		return nullptr;
+	}
+
+	// Returns the index of the last occurrence of the given value in the array, or the array size if not found
+	// Note: Arithmetic element types are searched using vectorized instructions.
+	size_t ReverseIndexOf(const T& value, const size_t from = 0, const size_t to = s_maxSize) const
 	{
-		return Size();
+		if constexpr (Simd::Arithmetic<T>)
+		{
+			if (Self().Size() == 0)
+			{
+				return Self().Size();
+			}
+
+			const size_t size = RangeEnd(from, to);
+			if (size <= from)
+			{
+				return Self().Size();
+			}
+			const size_t index = Simd::ReverseIndexOf(Self().Data() + from, size - from, value);
+			return (index < size - from) ? from + index : Self().Size();
+		}
+		return ReverseIndexOf([&](const T& element) { return element == value; }, from, to);
 	}
 
-	// Sort helper method - sorts the array using an insertion sort algorithm
+	// Returns the index of the last occurrence of nullptr in the array, or the array size if not found
+	size_t ReverseIndexOf(std::nullptr_t, const size_t from = 0, const size_t to = s_maxSize) const
+	{
+		return ReverseIndexOf([](const T& element) { return element == nullptr; }, from, to);
+	}
+
+	// Returns the index of the last element in the array that satisfies the predicate, or the array size if not found
 	template<typename Predicate>
-	bool InsertionSort(const Predicate& predicate, const size_t from, const size_t to)
+	size_t ReverseIndexOf(const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize) const
 	{
-		bool dirty = false;
-		// Iterates through the array from left to right
-		for (size_t i = from + 1; i <= to; ++i)
+		if (Self().Size() == 0)
 		{
-			const T element = Data()[i];
+			return Self().Size();
+		}
 
-			size_t j = i;
+		BoundsCheck(from);
+		const size_t size = (to == s_maxSize) ? Self().Size() : to;
+		BoundsCheck(size - 1);
 
-			// Shift lower elements to the right until the correct position for the current element is found
-			while (j > from && predicate(element, Data()[j - 1]))
+		for (size_t i = size; i > from; --i)
+		{
+			if (predicate(Self().Data()[i - 1]))
 			{
-				Data()[j] = Data()[j - 1];
-				--j;
-				dirty = true;
+				return i - 1;
 			}
+		}
+		return Self().Size();
+	}
 
-			// Insert the element in the correct position
-			Data()[j] = element;
+
+	// Randomly shuffles the array using a Fisher-Yates algorithm
+	// Note: A generator seeded from std::random_device is used, so pass an engine instead to make the shuffle reproducible.
+	bool Shuffle()
+	{
+		thread_local Random random;
+		return Shuffle(random);
+	}
+
+	// Randomly shuffles the array using a Fisher-Yates algorithm and the given random number engine (e.g. Random or std::mt19937_64)
+	// Note: Positions are picked without modulo bias, so every permutation is equally likely.
+	template<std::uniform_random_bit_generator Engine>
+	bool Shuffle(Engine& engine)
+	{
+		FisherYatesShuffle(engine, Self().Data(), Self().Size());
+		return Self().Size() > 1;
+	}
+
+	// Randomly shuffles the array using the given execution policy
+	// Note: A generator seeded from std::random_device is used, so pass an engine instead to make the shuffle reproducible.
+	bool Shuffle(const ExecutionPolicy policy)
+	{
+		thread_local Random random;
+		return Shuffle(policy, random);
+	}
+
+	// Randomly shuffles the array using the given execution policy and random number engine
+	// Note: A parallel shuffle uses the MergeShuffle algorithm, which shuffles blocks independently and then merges them in pairs by randomly interleaving them, so every permutation is still equally likely.
+	// The blocks and merges are seeded from the engine in a fixed order, so the result does not depend on the number of threads. A sequential shuffle will be used instead for small arrays.
+	template<std::uniform_random_bit_generator Engine>
+	bool Shuffle(const ExecutionPolicy policy, Engine& engine)
+	{
+		if (policy == ExecutionPolicy::Sequential || Self().Size() < 2 * s_shuffleBlockSize)
+		{
+			return Shuffle(engine);
 		}
-		return dirty;
+
+		MergeShuffle(std::uniform_int_distribution<uint64_t>()(engine));
+		return true;
 	}
 
-	// Sort helper method - performs a single iteration of a quick sort algorithm and returns the pivot index
-	template<typename Predicate>
-	size_t Partition(const Predicate& predicate, const size_t from, const size_t to)
+	// Returns the size of the array
+	// Note: Derived arrays provide this method, which hides this version. It allows the size to be taken through a reference to this class.
+	constexpr const size_t Size() const
+	{
+		return Self().Size();
+	}
+
+	// Returns a view of the elements within the specified range, without copying them
+	// Note: ArrayView.h must be included to use this method. The view refers to the elements of the array, so it is invalidated if the array is resized or destroyed.
+	ArrayView<T> Slice(const size_t from = 0, const size_t to = s_maxSize)
+	{
+		const size_t size = SliceEnd(from, to);
+		return size > from ? ArrayView<T>(Self().Data() + from, size - from) : ArrayView<T>();
+	}
+
+	// Returns a view of the elements within the specified range, without copying them (const version)
+	// Note: ArrayView.h must be included to use this method. The view refers to the elements of the array, so it is invalidated if the array is resized or destroyed.
+	ArrayView<const T> Slice(const size_t from = 0, const size_t to = s_maxSize) const
 	{
-		// Sorts the left, middle, and right elements of the array (median of three method)
-		const size_t mid = (from + to) / 2;
-		if (predicate(Data()[mid], Data()[from]))
+		const size_t size = SliceEnd(from, to);
+		return size > from ? ArrayView<const T>(Self().Data() + from, size - from) : ArrayView<const T>();
+	}
+
+	// Sorts the elements of the array in either ascending (default) or descending order
+	// Note: Arithmetic element types are sorted using a radix sort (or a counting sort for 8/16-bit types), and other types using an introspective sort.
+	// An insertion sort will be used instead for small arrays. Floating point NaNs are always placed at the end of the range.
+	constexpr bool Sort(const SortOrder order = SortOrder::Ascending, const size_t from = 0, const size_t to = s_maxSize, const size_t insertionSortThreshold = s_defaultInsertionSortThreshold)
+	{
+		if constexpr (s_radixSortable)
 		{
-			Swap(from, mid);
+			if (!std::is_constant_evaluated())
+			{
+				if (Self().Size() == 0)
+				{
+					return false;
+				}
+
+				BoundsCheck(from);
+				const size_t size = (to == s_maxSize) ? Self().Size() - 1 : to;
+				BoundsCheck(size);
+
+				if (size >= from && size - from >= s_radixSortThreshold)
+				{
+					return RadixSort(order, from, size);
+				}
+			}
 		}
-		if (predicate(Data()[to], Data()[from]))
+
+		if (order == SortOrder::Ascending)
 		{
-			Swap(from, to);
+			return Sort(OrderPredicate<SortOrder::Ascending>(), from, to, insertionSortThreshold);
 		}
-		if (predicate(Data()[to], Data()[mid]))
+		return Sort(OrderPredicate<SortOrder::Descending>(), from, to, insertionSortThreshold);
+	}
+
+	// Sorts the elements of the array using an introspective sort algorithm based on the given predicate
+	// Note: An insertion sort will be used instead for small arrays, and a heap sort if partitioning degrades, so the worst case is O(n log n).
+	// In constant expressions std::sort is used instead, as the introspective sort relies on sorting networks with static tables.
+	template<typename Predicate>
+	constexpr bool Sort(const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize, const size_t insertionSortThreshold = s_defaultInsertionSortThreshold)
+	{
+		if (Self().Size() == 0)
 		{
-			Swap(mid, to);
+			return false;
 		}
 
-		// Selects the middle element as the pivot element and moves it next to the end of the array
-		const T& pivotElement = Data()[mid];
-		Swap(mid, to - 1);
+		BoundsCheck(from);
+		const size_t size = (to == s_maxSize) ? Self().Size() - 1 : to;
+		BoundsCheck(size);
 
-		// Sorts the array so that elements smaller than the pivot element are on the left, and elements larger than the pivot element are on the right
-		size_t pivotIndex = from;
-		for (size_t i = from + 1; i < to - 1; ++i)
+		if (std::is_constant_evaluated())
 		{
-			if (predicate(Data()[i], pivotElement))
+			T* const data = Self().Data();
+			if (size <= from || std::is_sorted(data + from, data + size + 1, predicate))
 			{
-				++pivotIndex;
-				Swap(i, pivotIndex);
+				return false;
 			}
+			std::sort(data + from, data + size + 1, predicate);
+			return true;
 		}
 
-		// Places the pivot element in the correct position in the sorted array
-		++pivotIndex;
-		Swap(pivotIndex, to - 1);
+		return IntroSort(predicate, from, size, insertionSortThreshold, SortDepthLimit(size - from + 1));
+	}
 
-		return pivotIndex;
+	// Sorts the elements of the array using the given execution policy in either ascending (default) or descending order
+	// Note: A sequential sort will be used instead for arrays smaller than the parallel sort threshold. Sequential sorts of arithmetic element types are radix sorted (see Sort).
+	bool Sort(const ExecutionPolicy policy, const SortOrder order = SortOrder::Ascending, const size_t from = 0, const size_t to = s_maxSize, const size_t parallelSortThreshold = s_defaultParallelSortThreshold)
+	{
+		if constexpr (s_radixSortable)
+		{
+			if (policy == ExecutionPolicy::Sequential)
+			{
+				return Sort(order, from, to);
+			}
+		}
+
+		if (order == SortOrder::Ascending)
+		{
+			return Sort(policy, OrderPredicate<SortOrder::Ascending>(), from, to, parallelSortThreshold);
+		}
+		return Sort(policy, OrderPredicate<SortOrder::Descending>(), from, to, parallelSortThreshold);
 	}
 
-	// Sort helper method - recursively performs a quick sort algorithm until the array is sorted
+	// Sorts the elements of the array using the given execution policy based on the given predicate
+	// Note: A sequential sort will be used instead for arrays smaller than the parallel sort threshold. The predicate must be safe to call from multiple threads.
 	template<typename Predicate>
-	bool QuickSort(const Predicate& predicate, const size_t from, const size_t to, const size_t insertionSortThreshold = s_defaultInsertionSortThreshold)
+	bool Sort(const ExecutionPolicy policy, const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize, const size_t parallelSortThreshold = s_defaultParallelSortThreshold)
 	{
-		// Checks if the indices to be sorted are valid and that there is more than 1 element in the array
-		if (to <= from || to >= Size())
+		if (Self().Size() == 0)
 		{
 			return false;
 		}
 
-		// If there are only two elements, just compare and swap
-		if (to - from == 1)
+		BoundsCheck(from);
+		const size_t size = (to == s_maxSize) ? Self().Size() - 1 : to;
+		BoundsCheck(size);
+
+		const size_t threadCount = ThreadCount();
+		if (policy == ExecutionPolicy::Sequential || threadCount < 2 || size < from || size - from < parallelSortThreshold)
+		{
+			return IntroSort(predicate, from, size, s_defaultInsertionSortThreshold, SortDepthLimit(size - from + 1));
+		}
+
+		return ParallelSort(predicate, from, size, parallelSortThreshold, threadCount);
+	}
+
+	// Sorts the elements of the array using a stable adaptive merge sort algorithm in either ascending (default) or descending order
+	// Note: Equal elements keep their relative order. Floating point NaNs are always placed at the end of the range.
+	bool StableSort(const SortOrder order = SortOrder::Ascending, const size_t from = 0, const size_t to = s_maxSize)
+	{
+		if (order == SortOrder::Ascending)
+		{
+			return StableSort(OrderPredicate<SortOrder::Ascending>(), from, to);
+		}
+		return StableSort(OrderPredicate<SortOrder::Descending>(), from, to);
+	}
+
+	// Sorts the elements of the array using a stable adaptive merge sort algorithm based on the given predicate
+	// Note: Equal elements keep their relative order. Existing sorted and reverse sorted runs are detected and merged, so partially sorted arrays are sorted in close to linear time.
+	template<typename Predicate>
+	bool StableSort(const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize)
+	{
+		if (Self().Size() == 0)
 		{
-			if (predicate(Data()[to], Data()[from]))
-			{
-				Swap(from, to);
-				return true;
-			}
 			return false;
 		}
 
-		// If the number of elements is less than the threshold, performs an insertion sort instead to save on recursion overhead
-		if (to - from < insertionSortThreshold)
+		BoundsCheck(from);
+		const size_t size = (to == s_maxSize) ? Self().Size() - 1 : to;
+		BoundsCheck(size);
+
+		if (size <= from)
 		{
-			return InsertionSort(predicate, from, to);
+			return false;
 		}
 
-		// Partitions the array into two sub-arrays on either side of a pivot index
-		const size_t pivot = Partition(predicate, from, to);
+		return MergeSort(predicate, from, size);
+	}
+
+	// Swaps the elements at the given indices
+	constexpr bool Swap(const size_t index1, const size_t index2)
+	{
+		if (index1 == index2)
+		{
+			return false;
+		}
+		BoundsCheck(index1);
+		BoundsCheck(index2);
 
-		// Recursively sorts each sub-array
-		QuickSort(predicate, from, pivot - 1);
-		QuickSort(predicate, pivot + 1, to);
+		const T temp = std::move(Self().Data()[index1]);
+		Self().Data()[index1] = std::move(Self().Data()[index2]);
+		Self().Data()[index2] = std::move(temp);
 
 		return true;
 	}
 
-	static constexpr size_t s_defaultInsertionSortThreshold = 10; // By default, an insertion sort will be performed if the array size is less than this threshold
-	static constexpr size_t s_maxSize = std::numeric_limits<size_t>::max(); // The maximum size of the array
+	// Returns a new array with the given number of largest (default) or smallest elements within the range, in order
+	// Note: DynamicArray.h must be included to use this method.
+	DynamicArray<T> TopK(const size_t count, const SortOrder order = SortOrder::Descending, const size_t from = 0, const size_t to = s_maxSize) const
+	{
+		if (order == SortOrder::Ascending)
+		{
+			return TopK(count, OrderPredicate<SortOrder::Ascending>(), from, to);
+		}
+		return TopK(count, OrderPredicate<SortOrder::Descending>(), from, to);
+	}
+
+	// Returns a new array with the given number of elements within the range that would come first if it was sorted based on the given predicate, in order
+	// Note: DynamicArray.h must be included to use this method. For small counts a bounded heap is used, so most elements only need a single comparison.
+	template<typename Predicate>
+	DynamicArray<T> TopK(const size_t count, const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize) const
+	{
+		if (Self().Size() == 0 || count == 0)
+		{
+			return DynamicArray<T>();
+		}
+
+		BoundsCheck(from);
+		const size_t size = (to == s_maxSize) ? Self().Size() - 1 : to;
+		BoundsCheck(size);
+
+		const T* const data = Self().Data() + from;
+		const size_t rangeSize = size - from + 1;
+
+		// For large counts, selects the elements from a copy of the whole range instead
+		if (count > rangeSize / s_heapSelectRatio)
+		{
+			DynamicArray<T> result(data, rangeSize);
+			result.PartialSort(count, predicate);
+			result.Resize(count < rangeSize ? count : rangeSize);
+			return result;
+		}
+
+		// Keeps a max heap of the elements that would come first, so the heap's first element is the one to replace
+		DynamicArray<T> result(data, count);
+		T* const heap = result.Data();
+		for (size_t i = count / 2; i > 0; --i)
+		{
+			SiftDown(predicate, heap, i - 1, count);
+		}
+		for (size_t i = count; i < rangeSize; ++i)
+		{
+			if (predicate(data[i], heap[0]))
+			{
+				heap[0] = data[i];
+				SiftDown(predicate, heap, 0, count);
+			}
+		}
+
+		result.Sort(predicate);
+		return result;
+	}
+
+	// Returns the element at the specified index, which is never checked to be within bounds
+	// Note: Use this for indices that are already known to be valid, as an index outside the bounds of the array is undefined behavior.
+	constexpr T& Unchecked(const size_t index)
+	{
+		return Self().Data()[index];
+	}
+
+	// Returns the element at the specified index, which is never checked to be within bounds (const version)
+	constexpr const T& Unchecked(const size_t index) const
+	{
+		return Self().Data()[index];
+	}
+
+	// Returns the index of the first element within the sorted range that is ordered after the given value, which must be in either ascending (default) or descending order, or the end of the range if there is none
+	size_t UpperBound(const T& value, const SortOrder order = SortOrder::Ascending, const size_t from = 0, const size_t to = s_maxSize) const
+	{
+		if (order == SortOrder::Ascending)
+		{
+			return UpperBound(value, OrderPredicate<SortOrder::Ascending>(), from, to);
+		}
+		return UpperBound(value, OrderPredicate<SortOrder::Descending>(), from, to);
+	}
+
+	// Returns the index of the first element within the range sorted based on the given predicate that is ordered after the given value, or the end of the range if there is none
+	// Note: A branchless binary search is used, which also prefetches both of the possible next elements for large arrays, so the worst case is O(log n).
+	template<typename Predicate>
+	size_t UpperBound(const T& value, const Predicate& predicate, const size_t from = 0, const size_t to = s_maxSize) const
+	{
+		if (Self().Size() == 0)
+		{
+			return 0;
+		}
+
+		const size_t size = RangeEnd(from, to);
+		if (size <= from)
+		{
+			return from;
+		}
+
+		return from + SearchBound<true>(predicate, Self().Data() + from, size - from, value);
+	}
+
+protected:
+	// Default constructor
+	ArrayBase() = default;
+
+	// Default destructor
+	// Note: Arrays are not deleted through this class, so the destructor is not virtual (see Array for a runtime interface).
+	~ArrayBase() = default;
+
+	// The index used for bounds checks
+	// Note: Derived arrays may provide their own version, e.g. to allow indexing beyond their size.
+	constexpr size_t Bounds() const
+	{
+		return Self().Size();
+	}
+
+	// Returns this array as its derived type, so that the methods it provides are called without virtual dispatch
+	constexpr Derived& Self()
+	{
+		return static_cast<Derived&>(*this);
+	}
+
+	// Returns this array as its derived type (const version)
+	constexpr const Derived& Self() const
+	{
+		return static_cast<const Derived&>(*this);
+	}
+
+	// Returns the default threshold below which an insertion sort will be performed
+	static constexpr size_t DefaultInsertionSortThreshold()
+	{
+		return s_defaultInsertionSortThreshold;
+	}
+
+	// Returns the maximum size of the array
+	static constexpr size_t MaxSize()
+	{
+		return s_maxSize;
+	}
+
+	// Sort helper method - sorts N elements using a sorting network generated at compile time
+	// Note: Every comparison is made regardless of the data and elements are exchanged using conditional moves, so there are no branches to mispredict.
+	template<size_t N, typename Predicate>
+	static bool NetworkSort(const Predicate& predicate, T* data)
+	{
+		static constexpr auto comparators = []
+		{
+			std::array<std::pair<uint8_t, uint8_t>, SortingNetwork(N)> result{};
+			SortingNetwork(N, result.data());
+			return result;
+		}();
+
+		// The network is fully unrolled on a local copy of the elements, so that they can be kept in registers
+		T values[N];
+		std::copy(data, data + N, values);
+		bool dirty = false;
+		[&]<size_t... I>(std::index_sequence<I...>)
+		{
+			(CompareExchange(predicate, values[comparators[I].first], values[comparators[I].second], dirty), ...);
+		}(std::make_index_sequence<comparators.size()>{});
+		std::copy(values, values + N, data);
+		return dirty;
+	}
+
+	// Returns whether N elements can be sorted using a sorting network
+	template<size_t N>
+	static constexpr bool NetworkSortable()
+	{
+		return s_networkSortable && N <= s_maxNetworkSortSize;
+	}
+
+	// Sort helper method - returns a predicate that orders elements in an order known at compile time, with any floating point NaNs ordered last
+	// Note: The comparison has no branch on the order, so it can be compiled to conditional moves.
+	template<SortOrder Order>
+	static constexpr auto OrderPredicate()
+	{
+		return [](const T& a, const T& b)
+		{
+			if constexpr (std::is_floating_point_v<T>)
+			{
+				if (a != a || b != b) // NaN check
+				{
+					return a == a;
+				}
+			}
+			if constexpr (Order == SortOrder::Ascending)
+			{
+				return a < b;
+			}
+			else
+			{
+				return a > b;
+			}
+		};
+	}
+
+	// Checks that the index is within bounds, as configured by ARRAY_BOUNDS_CHECKING
+	constexpr void BoundsCheck([[maybe_unused]] const size_t index) const
+	{
+		if constexpr (s_boundsChecking == BoundsChecking::Checked)
+		{
+			CheckedBoundsCheck(index);
+		}
+		else if constexpr (s_boundsChecking == BoundsChecking::DebugOnly)
+		{
+			assert(index < Self().Bounds() && "Array index out of bounds");
+		}
+	}
+
+	// Throws an exception if the index is out of bounds
+	constexpr void CheckedBoundsCheck(const size_t index) const
+	{
+		if (index >= Self().Bounds())
+		{
+			throw std::out_of_range("Array index out of bounds");
+		}
+	}
+
+	// Returns the end of the range (exclusive), after checking that the range is within bounds
+	size_t RangeEnd(const size_t from, const size_t to) const
+	{
+		BoundsCheck(from);
+		const size_t size = (to == s_maxSize) ? Self().Size() : to;
+		BoundsCheck(size - 1);
+		return size;
+	}
+
+	// Returns the end of a slice (exclusive), after checking that the slice is within bounds
+	// Note: Unlike other ranges, a slice may be empty, in which case only the end is checked to be within bounds.
+	size_t SliceEnd(const size_t from, const size_t to) const
+	{
+		const size_t size = (to == s_maxSize) ? Self().Size() : to;
+		if (size > from)
+		{
+			BoundsCheck(from);
+		}
+		if (size > 0)
+		{
+			BoundsCheck(size - 1);
+		}
+		return size;
+	}
+
+private:
+	// Enum for the result of checking whether a range is already sorted
+	enum class SortedRun
+	{
+		None,
+		Ascending,
+		Descending
+	};
+
+	// The unsigned integer type used as the key for radix sorts
+	using RadixKey = std::conditional_t<sizeof(T) == 1, uint8_t, std::conditional_t<sizeof(T) == 2, uint16_t, std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>>;
+
+	// Copies or moves the elements from the source array into the destination array
+	static constexpr bool CopyOrMove(T* source, const size_t sourceSize, T* destination, const size_t destinationSize, const size_t offset = 0, bool move = false)
+	{
+		// Note: Self-assignment isn't checked in constant expressions, where unrelated addresses can't always be compared, as copying elements onto themselves is harmless.
+		if (std::is_constant_evaluated() || source != destination + offset) // Check for self-assignment
+		{
+			if (destinationSize < sourceSize + offset)
+			{
+				throw std::length_error("Destination array cannot be smaller than source array");
+			}
+
+			if constexpr (std::is_trivially_copyable_v<T>)
+			{
+				if (!std::is_constant_evaluated())
+				{
+					Simd::Copy(destination + offset, source, sourceSize * sizeof(T));
+					return sourceSize > 0;
+				}
+			}
+
+			for (size_t i = 0; i < sourceSize; ++i)
+			{
+				destination[i + offset] = move ? std::move(source[i]) : source[i];
+			}
+			return sourceSize > 0;
+		}
+		return false;
+	}
+
+	// Copies or moves the elements from the source array into the destination array
+	static constexpr bool CopyOrMove(const T* source, const size_t sourceSize, T* destination, const size_t destinationSize, const size_t offset = 0)
+	{
+		return CopyOrMove(const_cast<T*>(source), sourceSize, destination, destinationSize, offset);
+	}
+
+	// Returns whether two raw arrays are equal
+	static constexpr bool Equals(const T* left, const size_t leftSize, const T* right, const size_t rightSize)
+	{
+		if (leftSize != rightSize)
+		{
+			return false;
+		}
+
+		if constexpr (Simd::Arithmetic<T>)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				return Simd::Equals(left, right, leftSize);
+			}
+		}
+
+		if constexpr (std::equality_comparable<T>)
+		{
+			for (size_t i = 0; i < leftSize; ++i)
+			{
+				if (left[i] != right[i])
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		else
+		{
+			return std::memcmp(left, right, leftSize * sizeof(T)) == 0;
+		}
+	}
+
+	// Sort helper method - sorts the array using a heap sort algorithm
+	template<typename Predicate>
+	bool HeapSort(const Predicate& predicate, const size_t from, const size_t to)
+	{
+		T* const data = Self().Data() + from;
+		const size_t size = to - from + 1;
+
+		// Rearranges the elements into a max heap
+		for (size_t i = size / 2; i > 0; --i)
+		{
+			SiftDown(predicate, data, i - 1, size);
+		}
+
+		// Repeatedly moves the largest remaining element to the end of the unsorted region
+		for (size_t i = size - 1; i > 0; --i)
+		{
+			std::swap(data[0], data[i]);
+			SiftDown(predicate, data, 0, i);
+		}
+		return size > 1;
+	}
+
+	// Sort helper method - sorts the given number of elements using the sorting network for that size
+	// Note: The networks for every size are stored one after another in a single table, so only one function is needed for each predicate.
+	template<typename Predicate>
+	static bool NetworkSort(const Predicate& predicate, T* data, const size_t size)
+	{
+		static constexpr size_t count = []
+		{
+			size_t result = 0;
+			for (size_t i = 0; i <= s_maxNetworkSortSize; ++i)
+			{
+				result += SortingNetwork(i);
+			}
+			return result;
+		}();
+
+		struct Networks
+		{
+			std::array<std::pair<uint8_t, uint8_t>, count> comparators;
+			std::array<size_t, s_maxNetworkSortSize + 2> offsets;
+		};
+
+		static constexpr Networks networks = []
+		{
+			Networks result{};
+			for (size_t i = 0; i <= s_maxNetworkSortSize; ++i)
+			{
+				result.offsets[i + 1] = result.offsets[i] + SortingNetwork(i, result.comparators.data() + result.offsets[i]);
+			}
+			return result;
+		}();
+
+		bool dirty = false;
+		for (size_t i = networks.offsets[size]; i < networks.offsets[size + 1]; ++i)
+		{
+			CompareExchange(predicate, data[networks.comparators[i].first], data[networks.comparators[i].second], dirty);
+		}
+		return dirty;
+	}
+
+	// Sort helper method - sorts the array using an insertion sort algorithm
+	template<typename Predicate>
+	bool InsertionSort(const Predicate& predicate, const size_t from, const size_t to)
+	{
+		T* const data = Self().Data();
+
+		bool dirty = false;
+		// Iterates through the array from left to right
+		for (size_t i = from + 1; i <= to; ++i)
+		{
+			if (!predicate(data[i], data[i - 1]))
+			{
+				continue;
+			}
+
+			T element = std::move(data[i]);
+
+			size_t j = i;
+
+			// Shift lower elements to the right until the correct position for the current element is found
+			while (j > from && predicate(element, data[j - 1]))
+			{
+				data[j] = std::move(data[j - 1]);
+				--j;
+			}
+
+			// Insert the element in the correct position
+			data[j] = std::move(element);
+			dirty = true;
+		}
+		return dirty;
+	}
+
+	// Sort helper method - recursively performs a pattern-defeating introspective sort until the array is sorted
+	// Note: Only the smaller partition is sorted recursively, so the recursion depth never exceeds log2 of the array size.
+	template<typename Predicate>
+	bool IntroSort(const Predicate& predicate, size_t from, size_t to, const size_t insertionSortThreshold, size_t depthLimit, bool leftmost = true)
+	{
+		T* const data = Self().Data();
+
+		bool dirty = false;
+		while (from < to)
+		{
+			// If there are only two elements, just compare and swap
+			if (to - from == 1)
+			{
+				if (predicate(data[to], data[from]))
+				{
+					std::swap(data[from], data[to]);
+					return true;
+				}
+				return dirty;
+			}
+
+			// If the number of elements is less than the threshold, performs an insertion sort (or uses a sorting network for cheaply copied types) instead to save on recursion overhead
+			if (to - from < insertionSortThreshold)
+			{
+				if constexpr (s_networkSortable)
+				{
+					if (to - from < s_maxNetworkSortSize)
+					{
+						return NetworkSort(predicate, data + from, to - from + 1) || dirty;
+					}
+				}
+				return InsertionSort(predicate, from, to) || dirty;
+			}
+
+			// If too many unbalanced partitions have been made, falls back to a heap sort to guarantee O(n log n) time
+			if (depthLimit == 0)
+			{
+				return HeapSort(predicate, from, to) || dirty;
+			}
+			--depthLimit;
+
+			// Detects runs that are already sorted or reverse sorted
+			const SortedRun run = FindSortedRun(predicate, from, to);
+			if (run == SortedRun::Ascending)
+			{
+				return dirty;
+			}
+			if (run == SortedRun::Descending)
+			{
+				ReverseRange(from, to);
+				return true;
+			}
+
+			// If the pivot is equal to the preceding pivot then every element equal to it is already in place, so they are skipped in one pass
+			SelectPivot(predicate, from, to);
+			if (!leftmost && !predicate(data[from - 1], data[to - 1]))
+			{
+				from = PartitionEqual(predicate, from, to);
+				dirty = true;
+				continue;
+			}
+
+			// Partitions the array into two sub-arrays on either side of a pivot index
+			const size_t pivot = Partition(predicate, from, to, false);
+			dirty = true;
+
+			// Recursively sorts the smaller sub-array and loops on the larger one
+			if (pivot - from < to - pivot)
+			{
+				if (pivot > from)
+				{
+					IntroSort(predicate, from, pivot - 1, insertionSortThreshold, depthLimit, leftmost);
+				}
+				from = pivot + 1;
+				leftmost = false;
+			}
+			else
+			{
+				IntroSort(predicate, pivot + 1, to, insertionSortThreshold, depthLimit, false);
+				to = pivot - 1;
+			}
+		}
+		return dirty;
+	}
+
+	// Sort helper method - orders two elements using conditional moves instead of a branch
+	template<typename Predicate>
+	static void CompareExchange(const Predicate& predicate, T& left, T& right, bool& dirty)
+	{
+		const T a = left;
+		const T b = right;
+		const bool swap = predicate(b, a);
+		left = swap ? b : a;
+		right = swap ? a : b;
+		dirty |= swap;
+	}
+
+	// Sort helper method - returns whether the elements within the range are already sorted or reverse sorted
+	template<typename Predicate>
+	SortedRun FindSortedRun(const Predicate& predicate, const size_t from, const size_t to) const
+	{
+		const T* const data = Self().Data();
+
+		bool ascending = true;
+		bool descending = true;
+		for (size_t i = from; i < to && (ascending || descending); ++i)
+		{
+			ascending = ascending && !predicate(data[i + 1], data[i]);
+			descending = descending && !predicate(data[i], data[i + 1]);
+		}
+		return ascending ? SortedRun::Ascending : descending ? SortedRun::Descending : SortedRun::None;
+	}
+
+	// Sort helper method - sorts the array using a binary insertion sort algorithm, where the elements before the start index are already sorted
+	// Note: Each element is inserted after any equal elements, so the sort is stable.
+	template<typename Predicate>
+	static bool BinaryInsertionSort(const Predicate& predicate, T* data, const size_t size, const size_t start)
+	{
+		bool dirty = false;
+		for (size_t i = start; i < size; ++i)
+		{
+			// Finds the first element greater than the current element
+			size_t low = 0;
+			size_t high = i;
+			while (low < high)
+			{
+				const size_t mid = low + (high - low) / 2;
+				if (predicate(data[i], data[mid]))
+				{
+					high = mid;
+				}
+				else
+				{
+					low = mid + 1;
+				}
+			}
+
+			if (low < i)
+			{
+				T element = std::move(data[i]);
+				std::move_backward(data + low, data + i, data + i + 1);
+				data[low] = std::move(element);
+				dirty = true;
+			}
+		}
+		return dirty;
+	}
+
+	// Sort helper method - returns the length of the run starting at the given index, reversing it first if it is strictly descending
+	template<typename Predicate>
+	static size_t CountRun(const Predicate& predicate, T* data, const size_t size, bool& dirty)
+	{
+		if (size < 2)
+		{
+			return size;
+		}
+
+		size_t length = 2;
+		if (predicate(data[1], data[0]))
+		{
+			while (length < size && predicate(data[length], data[length - 1]))
+			{
+				++length;
+			}
+			std::reverse(data, data + length); // Strictly descending, so reversing keeps the sort stable
+			dirty = true;
+		}
+		else
+		{
+			while (length < size && !predicate(data[length], data[length - 1]))
+			{
+				++length;
+			}
+		}
+		return length;
+	}
+
+	// Sort helper method - merges two adjacent sorted runs using the scratch buffer, which must be able to hold the shorter of the two runs
+	// Note: Elements already in their final position at the start of the left run and the end of the right run are found by binary search and skipped.
+	template<typename Predicate>
+	static bool MergeRuns(const Predicate& predicate, T* left, size_t leftSize, T* right, size_t rightSize, T* buffer)
+	{
+		// Skips elements of the left run that are not greater than the first element of the right run
+		size_t low = 0;
+		size_t high = leftSize;
+		while (low < high)
+		{
+			const size_t mid = low + (high - low) / 2;
+			if (predicate(right[0], left[mid]))
+			{
+				high = mid;
+			}
+			else
+			{
+				low = mid + 1;
+			}
+		}
+		left += low;
+		leftSize -= low;
+		if (leftSize == 0)
+		{
+			return false;
+		}
+
+		// Skips elements of the right run that are not less than the last element of the left run
+		low = 0;
+		high = rightSize;
+		while (low < high)
+		{
+			const size_t mid = low + (high - low) / 2;
+			if (predicate(right[mid], left[leftSize - 1]))
+			{
+				low = mid + 1;
+			}
+			else
+			{
+				high = mid;
+			}
+		}
+		rightSize = low;
+
+		if (leftSize <= rightSize)
+		{
+			// Moves the left run into the buffer and merges forwards
+			std::move(left, left + leftSize, buffer);
+			T* destination = left;
+			size_t i = 0;
+			size_t j = 0;
+			while (i < leftSize && j < rightSize)
+			{
+				*destination++ = predicate(right[j], buffer[i]) ? std::move(right[j++]) : std::move(buffer[i++]);
+			}
+			std::move(buffer + i, buffer + leftSize, destination);
+		}
+		else
+		{
+			// Moves the right run into the buffer and merges backwards
+			std::move(right, right + rightSize, buffer);
+			T* destination = right + rightSize;
+			size_t i = leftSize;
+			size_t j = rightSize;
+			while (i > 0 && j > 0)
+			{
+				*--destination = predicate(buffer[j - 1], left[i - 1]) ? std::move(left[--i]) : std::move(buffer[--j]);
+			}
+			std::move_backward(buffer, buffer + j, destination);
+		}
+		return true;
+	}
+
+	// Sort helper method - sorts the array using a stable natural merge sort algorithm (based on TimSort)
+	// Note: Runs shorter than the minimum run length are extended using a binary insertion sort. Runs are kept on a stack and merged whenever their lengths stop decreasing fast enough, which keeps merges balanced.
+	template<typename Predicate>
+	bool MergeSort(const Predicate& predicate, const size_t from, const size_t to)
+	{
+		T* const data = Self().Data() + from;
+		const size_t size = to - from + 1;
+		const size_t minRun = MinRunLength(size);
+
+		std::unique_ptr<T[]> buffer; // Allocated once on the first merge and reused by every following merge
+		size_t runStarts[s_maxMergeRuns];
+		size_t runLengths[s_maxMergeRuns];
+		size_t runCount = 0;
+		bool dirty = false;
+
+		const auto merge = [&](const size_t run)
+		{
+			if (!buffer)
+			{
+				buffer.reset(new T[size / 2 + 1]);
+			}
+			T* const left = data + runStarts[run];
+			T* const right = data + runStarts[run + 1];
+			dirty = MergeRuns(predicate, left, runLengths[run], right, runLengths[run + 1], buffer.get()) || dirty;
+			runLengths[run] += runLengths[run + 1];
+			if (run + 2 < runCount)
+			{
+				runStarts[run + 1] = runStarts[run + 2];
+				runLengths[run + 1] = runLengths[run + 2];
+			}
+			--runCount;
+		};
+
+		size_t start = 0;
+		while (start < size)
+		{
+			// Finds the next run, and extends it to the minimum run length if it is too short
+			const size_t remaining = size - start;
+			size_t length = CountRun(predicate, data + start, remaining, dirty);
+			if (length < minRun)
+			{
+				const size_t extended = (remaining < minRun) ? remaining : minRun;
+				dirty = BinaryInsertionSort(predicate, data + start, extended, length) || dirty;
+				length = extended;
+			}
+
+			runStarts[runCount] = start;
+			runLengths[runCount] = length;
+			++runCount;
+			start += length;
+
+			// Merges runs until the lengths on the stack satisfy len[n - 2] > len[n - 1] + len[n] and len[n - 1] > len[n]
+			while (runCount > 1)
+			{
+				size_t n = runCount - 2;
+				if ((n > 0 && runLengths[n - 1] <= runLengths[n] + runLengths[n + 1]) || (n > 1 && runLengths[n - 2] <= runLengths[n - 1] + runLengths[n]))
+				{
+					if (runLengths[n - 1] < runLengths[n + 1])
+					{
+						--n;
+					}
+				}
+				else if (runLengths[n] > runLengths[n + 1])
+				{
+					break;
+				}
+				merge(n);
+			}
+		}
+
+		// Merges all remaining runs
+		while (runCount > 1)
+		{
+			merge(runCount - 2);
+		}
+		return dirty;
+	}
+
+	// Sort helper method - returns the minimum run length for a merge sort, chosen so that the number of runs is equal to or slightly less than a power of two
+	static constexpr size_t MinRunLength(size_t size)
+	{
+		size_t remainder = 0;
+		while (size >= 64)
+		{
+			remainder |= size & 1;
+			size >>= 1;
+		}
+		return size + remainder;
+	}
+
+	// Sort helper method - performs a parallel quick sort where worker threads take sub-arrays from a shared stack, partition them, and push one half back for other workers
+	// Note: Sub-arrays smaller than the parallel sort threshold are sorted sequentially by the worker that took them.
+	template<typename Predicate>
+	bool ParallelSort(const Predicate& predicate, const size_t from, const size_t to, const size_t parallelSortThreshold, const size_t threadCount)
+	{
+		struct Range
+		{
+			size_t from;
+			size_t to;
+			size_t depthLimit;
+			bool leftmost;
+		};
+
+		std::vector<Range> ranges = { { from, to, SortDepthLimit(to - from + 1), true } };
+		size_t pending = 1; // The number of ranges that are queued or being sorted
+		bool aborted = false;
+		std::atomic<bool> dirty = false;
+		std::mutex mutex;
+		std::condition_variable condition;
+
+		RunParallel(threadCount, [&](const size_t)
+		{
+			while (true)
+			{
+				Range range;
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+					condition.wait(lock, [&] { return !ranges.empty() || pending == 0 || aborted; });
+					if (ranges.empty())
+					{
+						return;
+					}
+					range = ranges.back();
+					ranges.pop_back();
+				}
+
+				try
+				{
+					if (ParallelSortRange(predicate, range.from, range.to, range.depthLimit, range.leftmost, parallelSortThreshold, [&](const size_t pushFrom, const size_t pushTo, const size_t depthLimit)
+					{
+						{
+							std::lock_guard<std::mutex> lock(mutex);
+							ranges.push_back({ pushFrom, pushTo, depthLimit, false });
+							++pending;
+						}
+						condition.notify_one();
+					}))
+					{
+						dirty = true;
+					}
+				}
+				catch (...)
+				{
+					{
+						std::lock_guard<std::mutex> lock(mutex);
+						aborted = true;
+						ranges.clear();
+					}
+					condition.notify_all();
+					throw;
+				}
+
+				std::lock_guard<std::mutex> lock(mutex);
+				if (--pending == 0)
+				{
+					condition.notify_all();
+				}
+			}
+		});
+
+		return dirty;
+	}
+
+	// Sort helper method - partitions the range until it is smaller than the parallel sort threshold, pushing each right-hand sub-array to be sorted by another worker
+	template<typename Predicate, typename Push>
+	bool ParallelSortRange(const Predicate& predicate, size_t from, size_t to, size_t depthLimit, bool leftmost, const size_t parallelSortThreshold, const Push& push)
+	{
+		T* const data = Self().Data();
+
+		bool dirty = false;
+		while (to - from >= parallelSortThreshold && depthLimit > 0)
+		{
+			--depthLimit;
+
+			// Detects runs that are already sorted or reverse sorted
+			const SortedRun run = FindSortedRun(predicate, from, to);
+			if (run == SortedRun::Ascending)
+			{
+				return dirty;
+			}
+			if (run == SortedRun::Descending)
+			{
+				ReverseRange(from, to);
+				return true;
+			}
+
+			// Skips elements equal to the preceding pivot in one pass
+			SelectPivot(predicate, from, to);
+			dirty = true;
+			if (!leftmost && !predicate(data[from - 1], data[to - 1]))
+			{
+				from = PartitionEqual(predicate, from, to);
+				continue;
+			}
+
+			// Pushes the right-hand sub-array for another worker and continues partitioning the left-hand sub-array
+			const size_t pivot = Partition(predicate, from, to, false);
+			if (pivot < to)
+			{
+				push(pivot + 1, to, depthLimit);
+			}
+			if (pivot == from)
+			{
+				return dirty;
+			}
+			to = pivot - 1;
+		}
+
+		return IntroSort(predicate, from, to, s_defaultInsertionSortThreshold, depthLimit, leftmost) || dirty;
+	}
+
+	// Sort helper method - performs a single iteration of a quick sort algorithm and returns the pivot index
+	// Note: The range must contain at least three elements.
+	template<typename Predicate>
+	size_t Partition(const Predicate& predicate, const size_t from, const size_t to, const bool selectPivot = true)
+	{
+		if (selectPivot)
+		{
+			SelectPivot(predicate, from, to);
+		}
+
+		T* const data = Self().Data();
+
+		// Sorts the array so that elements smaller than the pivot element are on the left, and elements larger than the pivot element are on the right
+		// Note: The first and last elements act as sentinels, so the scans never leave the range.
+		const T& pivotElement = data[to - 1];
+		size_t left = from;
+		size_t right = to - 1;
+		while (true)
+		{
+			while (predicate(data[++left], pivotElement));
+			while (predicate(pivotElement, data[--right]));
+			if (left >= right)
+			{
+				break;
+			}
+			std::swap(data[left], data[right]);
+		}
+
+		// Places the pivot element in the correct position in the sorted array
+		std::swap(data[left], data[to - 1]);
+
+		return left;
+	}
+
+	// Sort helper method - moves all elements equal to the element preceding the range to the left, and returns the index after them
+	template<typename Predicate>
+	size_t PartitionEqual(const Predicate& predicate, const size_t from, const size_t to)
+	{
+		T* const data = Self().Data();
+
+		const T& pivotElement = data[from - 1];
+		size_t index = from;
+		for (size_t i = from; i <= to; ++i)
+		{
+			if (!predicate(pivotElement, data[i]))
+			{
+				std::swap(data[index++], data[i]);
+			}
+		}
+		return index;
+	}
+
+	// Sort helper method - sorts an arithmetic array using a least significant digit radix sort, or a counting sort for 8/16-bit types
+	// Note: Elements are mapped to unsigned keys whose ordering matches the requested sort order, one byte per pass. Passes where every key shares the same byte are skipped.
+	bool RadixSort(const SortOrder order, const size_t from, const size_t to)
+	{
+		T* const data = Self().Data() + from;
+		const size_t size = to - from + 1;
+
+		constexpr size_t passes = sizeof(RadixKey);
+		if constexpr (passes <= 2)
+		{
+			if (passes == 1 || size >= s_countingSortThreshold)
+			{
+				return CountingSort(order, data, size);
+			}
+		}
+
+		// Builds a histogram for each byte of the keys, while checking whether the array is already sorted
+		size_t counts[passes][256] = {};
+		bool sorted = true;
+		RadixKey previous = ToRadixKey(data[0], order);
+		for (size_t i = 0; i < size; ++i)
+		{
+			const RadixKey key = ToRadixKey(data[i], order);
+			sorted = sorted && previous <= key;
+			previous = key;
+			for (size_t pass = 0; pass < passes; ++pass)
+			{
+				++counts[pass][(key >> (pass * 8)) & 0xFF];
+			}
+		}
+		if (sorted)
+		{
+			return false;
+		}
+
+		// Distributes the elements between the array and a scratch buffer, from the least to the most significant byte
+		std::unique_ptr<T[]> buffer(new T[size]);
+		T* source = data;
+		T* destination = buffer.get();
+		for (size_t pass = 0; pass < passes; ++pass)
+		{
+			size_t* const count = counts[pass];
+			if (count[(ToRadixKey(source[0], order) >> (pass * 8)) & 0xFF] == size)
+			{
+				continue;
+			}
+
+			size_t offset = 0;
+			for (size_t digit = 0; digit < 256; ++digit)
+			{
+				const size_t digitCount = count[digit];
+				count[digit] = offset;
+				offset += digitCount;
+			}
+
+			for (size_t i = 0; i < size; ++i)
+			{
+				destination[count[(ToRadixKey(source[i], order) >> (pass * 8)) & 0xFF]++] = source[i];
+			}
+			std::swap(source, destination);
+		}
+
+		if (source != data)
+		{
+			std::copy(source, source + size, data);
+		}
+		return true;
+	}
+
+	// Sort helper method - sorts an 8/16-bit integral array by counting the occurrences of each key and rewriting the array in key order
+	bool CountingSort(const SortOrder order, T* data, const size_t size)
+	{
+		constexpr size_t keyCount = size_t(1) << (sizeof(RadixKey) * 8);
+		std::unique_ptr<size_t[]> counts(new size_t[keyCount]());
+
+		bool sorted = true;
+		RadixKey previous = ToRadixKey(data[0], order);
+		for (size_t i = 0; i < size; ++i)
+		{
+			const RadixKey key = ToRadixKey(data[i], order);
+			sorted = sorted && previous <= key;
+			previous = key;
+			++counts[key];
+		}
+		if (sorted)
+		{
+			return false;
+		}
+
+		size_t index = 0;
+		for (size_t key = 0; key < keyCount; ++key)
+		{
+			const T element = FromRadixKey(static_cast<RadixKey>(key), order);
+			for (size_t count = counts[key]; count > 0; --count)
+			{
+				data[index++] = element;
+			}
+		}
+		return true;
+	}
+
+	// Sort helper method - reverses the order of elements within the range
+	void ReverseRange(size_t from, size_t to)
+	{
+		T* const data = Self().Data();
+
+		while (from < to)
+		{
+			std::swap(data[from++], data[to--]);
+		}
+	}
+
+	// Sort helper method - performs an introspective selection until the element at the given index is in its sorted position
+	// Note: The range must shrink by a quarter with each partition on average, otherwise a median of medians pivot is used for the next one, so the worst case is O(n).
+	template<typename Predicate>
+	bool Select(const Predicate& predicate, size_t from, size_t to, const size_t index)
+	{
+		bool dirty = false;
+		size_t sizeLimit = 2 * (to - from + 1);
+		while (to - from >= s_defaultInsertionSortThreshold)
+		{
+			size_t pivot;
+			if (to - from + 1 > sizeLimit)
+			{
+				SelectMedianOfMediansPivot(predicate, from, to);
+				pivot = Partition(predicate, from, to, false);
+			}
+			else
+			{
+				pivot = Partition(predicate, from, to);
+			}
+			sizeLimit -= sizeLimit / 4;
+			dirty = true;
+
+			// Only the side containing the index needs to be partitioned further
+			if (pivot == index)
+			{
+				return true;
+			}
+			if (index < pivot)
+			{
+				to = pivot - 1;
+			}
+			else
+			{
+				from = pivot + 1;
+			}
+		}
+
+		// Small ranges are simply sorted (the range is below the threshold, so the depth limit is never reached)
+		return (from < to && IntroSort(predicate, from, to, s_defaultInsertionSortThreshold, 0)) || dirty;
+	}
+
+	// Sort helper method - moves the median of the medians of groups of five elements next to the end of the range, and the smallest and largest elements to either end as sentinels
+	// Note: The median of medians is guaranteed to be greater than and less than at least 30% of the elements, so partitioning around it always makes progress.
+	template<typename Predicate>
+	void SelectMedianOfMediansPivot(const Predicate& predicate, const size_t from, const size_t to)
+	{
+		T* const data = Self().Data();
+
+		// Moves the smallest and largest elements to either end, as required by the partition
+		size_t smallest = from;
+		size_t largest = from;
+		for (size_t i = from + 1; i <= to; ++i)
+		{
+			if (predicate(data[i], data[smallest]))
+			{
+				smallest = i;
+			}
+			if (!predicate(data[i], data[largest]))
+			{
+				largest = i;
+			}
+		}
+		std::swap(data[from], data[smallest]);
+		if (largest == from)
+		{
+			largest = smallest;
+		}
+		std::swap(data[to], data[largest]);
+
+		// Sorts each group of five elements between the sentinels and moves its median to the front
+		const size_t first = from + 1;
+		size_t medians = 0;
+		for (size_t group = first; group < to; group += 5)
+		{
+			const size_t last = (group + 4 < to) ? group + 4 : to - 1;
+			InsertionSort(predicate, group, last);
+			std::swap(data[first + medians++], data[group + (last - group) / 2]);
+		}
+
+		// Selects the median of the medians and moves it next to the end of the range
+		const size_t median = first + (medians - 1) / 2;
+		Select(predicate, first, first + medians - 1, median);
+		std::swap(data[median], data[to - 1]);
+	}
+
+	// Sort helper method - sorts the first, middle, and last elements (median of three method) and moves the median next to the end of the range
+	// Note: Large ranges use the median of three medians of three (ninther) instead, and the smallest and largest sampled elements are left at either end as sentinels.
+	template<typename Predicate>
+	void SelectPivot(const Predicate& predicate, const size_t from, const size_t to)
+	{
+		const size_t mid = from + (to - from) / 2;
+		SortThree(predicate, from, mid, to);
+		if (to - from >= s_nintherThreshold)
+		{
+			SortThree(predicate, from + 1, mid - 1, to - 1);
+			SortThree(predicate, from + 2, mid + 1, to - 2);
+			SortThree(predicate, mid - 1, mid, mid + 1);
+
+			// Each of the first three elements is no greater than one of the medians, so the smallest of them is no greater than the pivot (and likewise for the last three)
+			SortThree(predicate, from, from + 1, from + 2);
+			SortThree(predicate, to - 2, to - 1, to);
+		}
+		std::swap(Self().Data()[mid], Self().Data()[to - 1]);
+	}
+
+	// Sort helper method - maps an 8/16-bit integral radix key back to the element it was created from
+	static T FromRadixKey(RadixKey key, const SortOrder order)
+	{
+		if (order == SortOrder::Descending)
+		{
+			key = ~key;
+		}
+		if constexpr (std::is_signed_v<T>)
+		{
+			key ^= RadixKey(1) << (sizeof(RadixKey) * 8 - 1);
+		}
+		return static_cast<T>(key);
+	}
+
+	// Sort helper method - maps an arithmetic element to an unsigned radix key whose ordering matches the sort order
+	// Note: Signed integers have their sign bit flipped. Negative floating point numbers have all bits flipped and positive ones their sign bit, and NaNs map to the largest key.
+	static RadixKey ToRadixKey(const T& element, const SortOrder order)
+	{
+		constexpr RadixKey signBit = RadixKey(1) << (sizeof(RadixKey) * 8 - 1);
+
+		RadixKey key;
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			if (element != element) // NaN check
+			{
+				return std::numeric_limits<RadixKey>::max();
+			}
+			key = std::bit_cast<RadixKey>(element);
+			key = (key & signBit) ? ~key : key | signBit;
+		}
+		else
+		{
+			key = static_cast<RadixKey>(element);
+			if constexpr (std::is_signed_v<T>)
+			{
+				key ^= signBit;
+			}
+		}
+		return order == SortOrder::Ascending ? key : ~key;
+	}
+
+	// Sort helper method - sorts the three elements at the given indices
+	template<typename Predicate>
+	void SortThree(const Predicate& predicate, const size_t first, const size_t second, const size_t third)
+	{
+		T* const data = Self().Data();
+
+		if (predicate(data[second], data[first]))
+		{
+			std::swap(data[first], data[second]);
+		}
+		if (predicate(data[third], data[first]))
+		{
+			std::swap(data[first], data[third]);
+		}
+		if (predicate(data[third], data[second]))
+		{
+			std::swap(data[second], data[third]);
+		}
+	}
+
+	// Sort helper method - restores the max heap property for the subtree rooted at the given index
+	template<typename Predicate>
+	static void SiftDown(const Predicate& predicate, T* data, size_t index, const size_t size)
+	{
+		T element = std::move(data[index]);
+		while (true)
+		{
+			size_t child = 2 * index + 1;
+			if (child >= size)
+			{
+				break;
+			}
+			if (child + 1 < size && predicate(data[child], data[child + 1]))
+			{
+				++child;
+			}
+			if (!predicate(element, data[child]))
+			{
+				break;
+			}
+			data[index] = std::move(data[child]);
+			index = child;
+		}
+		data[index] = std::move(element);
+	}
+
+	// Search helper method - returns whether the element is ordered before the lower bound (or upper bound) of the given value
+	template<bool Upper, typename Predicate>
+	static bool BeforeBound(const Predicate& predicate, const T& element, const T& value)
+	{
+		if constexpr (Upper)
+		{
+			return !predicate(value, element);
+		}
+		else
+		{
+			return predicate(element, value);
+		}
+	}
+
+	// Search helper method - returns the number of elements at the start of the sorted raw array that are ordered before the lower bound (or upper bound) of the given value
+	// Note: The range is halved on every iteration whatever the comparison, so the next element is picked using a conditional move rather than a branch that would be mispredicted half the time.
+	template<bool Upper, typename Predicate>
+	static size_t SearchBound(const Predicate& predicate, const T* data, size_t size, const T& value)
+	{
+		if (size == 0)
+		{
+			return 0;
+		}
+
+		// While the range is large, the element compared next is likely not cached, so both candidates are prefetched before comparing the current one
+		const T* base = data;
+		while (size > s_searchPrefetchThreshold)
+		{
+			const size_t half = size / 2;
+			const size_t next = (size - half) / 2;
+			Simd::Prefetch(base + next);
+			Simd::Prefetch(base + half + next);
+			base = BeforeBound<Upper>(predicate, base[half], value) ? base + half : base;
+			size -= half;
+		}
+		while (size > 1)
+		{
+			const size_t half = size / 2;
+			base = BeforeBound<Upper>(predicate, base[half], value) ? base + half : base;
+			size -= half;
+		}
+		return static_cast<size_t>(base - data) + BeforeBound<Upper>(predicate, *base, value);
+	}
+
+	// Search helper method - performs a branchless binary search for each of the given values, interleaving the searches in groups
+	// Note: Every search in a group halves the same range size on each step, so they advance in lockstep and each prefetches its next element a whole group of searches ahead of using it.
+	template<bool Upper, typename Predicate>
+	static void SearchBounds(const Predicate& predicate, const T* data, const size_t size, const T* values, const size_t count, size_t* indices)
+	{
+		const T* bases[s_searchBatchSize];
+		for (size_t start = 0; start < count; start += s_searchBatchSize)
+		{
+			const size_t batchSize = (s_searchBatchSize < count - start) ? s_searchBatchSize : count - start;
+			const T* const batchValues = values + start;
+			if (size == 0)
+			{
+				std::fill(indices + start, indices + start + batchSize, size_t{ 0 });
+				continue;
+			}
+
+			for (size_t i = 0; i < batchSize; ++i)
+			{
+				bases[i] = data;
+			}
+			for (size_t remaining = size; remaining > 1;)
+			{
+				const size_t half = remaining / 2;
+				const size_t next = (remaining - half) / 2;
+				for (size_t i = 0; i < batchSize; ++i)
+				{
+					bases[i] = BeforeBound<Upper>(predicate, bases[i][half], batchValues[i]) ? bases[i] + half : bases[i];
+					Simd::Prefetch(bases[i] + next);
+				}
+				remaining -= half;
+			}
+			for (size_t i = 0; i < batchSize; ++i)
+			{
+				indices[start + i] = static_cast<size_t>(bases[i] - data) + BeforeBound<Upper>(predicate, *bases[i], batchValues[i]);
+			}
+		}
+	}
+
+	// Parallel helper method - lowers the found index to the given index if it is smaller, and returns whether an index was found
+	bool FoundIndex(std::atomic<size_t>& found, const size_t index) const
+	{
+		if (index == Self().Size())
+		{
+			return false;
+		}
+
+		size_t current = found.load(std::memory_order_relaxed);
+		while (index < current && !found.compare_exchange_weak(current, index, std::memory_order_relaxed))
+		{
+		}
+		return true;
+	}
+
+	// Parallel helper method - returns the index of the first element in the raw array that satisfies the predicate, or the size if not found
+	// Note: The matches in each block are counted before checking for any, so the block has no branches and can be vectorized. Only the block with the first match is searched element by element.
+	template<typename Predicate>
+	static size_t IndexOfUnsequenced(const Predicate& predicate, const T* data, const size_t size)
+	{
+		size_t i = 0;
+		for (; i + s_unsequencedBlockSize <= size; i += s_unsequencedBlockSize)
+		{
+			uint32_t matches = 0;
+			for (size_t j = 0; j < s_unsequencedBlockSize; ++j)
+			{
+				matches += predicate(data[i + j]) ? 1 : 0;
+			}
+			if (matches != 0)
+			{
+				break;
+			}
+		}
+		for (; i < size; ++i)
+		{
+			if (predicate(data[i]))
+			{
+				return i;
+			}
+		}
+		return size;
+	}
+
+	// Parallel helper method - splits the range into chunks and runs the function on each chunk, using worker threads unless the policy is sequential or the range is small
+	// Note: Cancellable ranges are split into small chunks that are taken in ascending order, and no more chunks are started once the function returns false for one.
+	// Otherwise the range is split evenly between the threads, so that each one works on a single contiguous chunk.
+	template<typename Function>
+	static void ParallelFor(const ExecutionPolicy policy, const size_t from, const size_t to, const bool cancellable, const Function& function)
+	{
+		const size_t size = to - from;
+		const size_t threadCount = ThreadCount();
+		if (policy == ExecutionPolicy::Sequential || threadCount < 2 || size <= s_parallelChunkSize)
+		{
+			function(from, to);
+			return;
+		}
+
+		const size_t evenChunkSize = (size + threadCount - 1) / threadCount;
+		const size_t chunkSize = cancellable ? s_parallelChunkSize : (evenChunkSize > s_parallelChunkSize ? evenChunkSize : s_parallelChunkSize);
+		const size_t chunkCount = (size + chunkSize - 1) / chunkSize;
+
+		std::atomic<size_t> nextChunk = 0;
+		std::atomic<bool> cancelled = false;
+		RunParallel(threadCount < chunkCount ? threadCount : chunkCount, [&](const size_t)
+		{
+			while (!cancelled.load(std::memory_order_relaxed))
+			{
+				const size_t chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+				if (chunk >= chunkCount)
+				{
+					break;
+				}
+
+				const size_t chunkFrom = from + chunk * chunkSize;
+				const size_t chunkTo = (chunkSize < to - chunkFrom) ? chunkFrom + chunkSize : to;
+				if (!function(chunkFrom, chunkTo) && cancellable)
+				{
+					cancelled.store(true, std::memory_order_relaxed);
+				}
+			}
+		});
+	}
+
+	// Parallel helper method - replaces the elements in the raw array that satisfy the predicate with the new value, and returns whether any were replaced
+	// Note: Trivially copyable elements are always written, either with the new value or their own, so the loop has no branches and can be vectorized.
+	template<typename Predicate>
+	static bool ReplaceUnsequenced(const Predicate& predicate, T* data, const size_t size, const T& newValue)
+	{
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			// The new value is copied so the compiler knows that writing the elements cannot change it
+			const T value = newValue;
+			size_t count = 0;
+			for (size_t i = 0; i < size; ++i)
+			{
+				const bool match = predicate(data[i]);
+				data[i] = match ? value : data[i];
+				count += match ? 1 : 0;
+			}
+			return count > 0;
+		}
+		else
+		{
+			bool dirty = false;
+			for (size_t i = 0; i < size; ++i)
+			{
+				if (predicate(data[i]))
+				{
+					data[i] = newValue;
+					dirty = true;
+				}
+			}
+			return dirty;
+		}
+	}
+
+	// Shuffle helper method - shuffles the raw array using a Fisher-Yates algorithm, swapping each element with a random one at or before it
+	template<typename Engine>
+	static void FisherYatesShuffle(Engine& engine, T* data, const size_t size)
+	{
+		for (size_t i = size; i > 1; --i)
+		{
+			std::swap(data[i - 1], data[Random::Bounded(engine, i)]);
+		}
+	}
+
+	// Shuffle helper method - merges two adjacent shuffled ranges of the raw array into one by randomly interleaving them, so that the result is also uniformly shuffled
+	// Note: Elements are taken from either range with equal probability until one runs out, and the remaining elements are then inserted at random positions before them.
+	static void MergeShuffled(Random& random, T* data, const size_t middle, const size_t size)
+	{
+		size_t i = 0;
+		size_t j = middle;
+		uint64_t bits = 0;
+		size_t bitCount = 0;
+		const auto flip = [&]()
+		{
+			// Each random number provides the coin flips for 64 steps
+			if (bitCount == 0)
+			{
+				bits = random();
+				bitCount = 64;
+			}
+			const bool result = bits & 1;
+			bits >>= 1;
+			--bitCount;
+			return result;
+		};
+
+		// The coin flips are random, so trivially copyable elements are exchanged by selecting values, which lets the compiler use conditional moves rather than a branch that would be mispredicted half the time
+		while (j < size)
+		{
+			const bool right = flip();
+			if (!right && i == j)
+			{
+				break;
+			}
+			if constexpr (std::is_trivially_copyable_v<T>)
+			{
+				const T left = data[i];
+				const T other = data[j];
+				data[i] = right ? other : left;
+				data[j] = right ? left : other;
+			}
+			else if (right)
+			{
+				std::swap(data[i], data[j]);
+			}
+			j += right;
+			++i;
+		}
+
+		// Once the right range has run out, the left range is taken from until a flip would take from the right range
+		if (j == size)
+		{
+			while (i < j && !flip())
+			{
+				++i;
+			}
+		}
+
+		for (; i < size; ++i)
+		{
+			std::swap(data[i], data[Random::Bounded(random, i + 1)]);
+		}
+	}
+
+	// Shuffle helper method - shuffles the array using the MergeShuffle algorithm, with the blocks (and then the merges of each level) spread across worker threads
+	// Note: Each block fits in the cache, so it is shuffled much faster than the random accesses across the whole array made by a single Fisher-Yates shuffle.
+	void MergeShuffle(const uint64_t seed)
+	{
+		T* const data = Self().Data();
+		const size_t size = Self().Size();
+		const size_t blockCount = std::bit_floor(size / s_shuffleBlockSize);
+		const size_t threadCount = ThreadCount();
+
+		// Blocks differ in size by at most one element
+		const auto boundary = [&](const size_t block)
+		{
+			return block * (size / blockCount) + std::min(block, size % blockCount);
+		};
+
+		// Runs the tasks on worker threads, each with its own generator seeded by the task's index
+		size_t firstTask = 0;
+		const auto runTasks = [&](const size_t taskCount, const auto& task)
+		{
+			std::atomic<size_t> nextTask = 0;
+			RunParallel(std::min(threadCount, taskCount), [&](const size_t)
+			{
+				for (size_t i = nextTask.fetch_add(1, std::memory_order_relaxed); i < taskCount; i = nextTask.fetch_add(1, std::memory_order_relaxed))
+				{
+					Random random(seed + firstTask + i);
+					task(random, i);
+				}
+			});
+			firstTask += taskCount;
+		};
+
+		runTasks(blockCount, [&](Random& random, const size_t block)
+		{
+			FisherYatesShuffle(random, data + boundary(block), boundary(block + 1) - boundary(block));
+		});
+		for (size_t width = 1; width < blockCount; width *= 2)
+		{
+			runTasks(blockCount / (2 * width), [&](Random& random, const size_t merge)
+			{
+				const size_t from = boundary(2 * width * merge);
+				MergeShuffled(random, data + from, boundary(2 * width * merge + width) - from, boundary(2 * width * (merge + 1)) - from);
+			});
+		}
+	}
+
+	// Runs the function on the given number of threads, including the calling thread, and waits for all of them to finish
+	// Note: The function is passed the index of the thread it is running on. The first exception thrown by any thread is rethrown on the calling thread.
+	template<typename Function>
+	static void RunParallel(const size_t threadCount, const Function& function)
+	{
+		std::exception_ptr exception;
+		std::mutex mutex;
+		const auto run = [&](const size_t index)
+		{
+			try
+			{
+				function(index);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				if (!exception)
+				{
+					exception = std::current_exception();
+				}
+			}
+		};
+
+		std::vector<std::thread> threads;
+		threads.reserve(threadCount - 1);
+		for (size_t i = 1; i < threadCount; ++i)
+		{
+			threads.emplace_back(run, i);
+		}
+		run(0);
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+
+		if (exception)
+		{
+			std::rethrow_exception(exception);
+		}
+	}
+
+	// Returns the number of worker threads used by parallel algorithms
+	static size_t ThreadCount()
+	{
+		const size_t hardwareThreads = std::thread::hardware_concurrency();
+		return hardwareThreads > 0 ? hardwareThreads : 1;
+	}
+
+	// Sort helper method - generates the comparators of a sorting network using Batcher's odd-even merge sort, and returns the number of comparators
+	// Note: The comparators are only written if an output is given, so that the number of comparators can be computed first.
+	static constexpr size_t SortingNetwork(const size_t size, std::pair<uint8_t, uint8_t>* comparators = nullptr)
+	{
+		size_t count = 0;
+		for (size_t p = 1; p < size; p <<= 1)
+		{
+			for (size_t k = p; k > 0; k >>= 1)
+			{
+				for (size_t j = k % p; j + k < size; j += 2 * k)
+				{
+					for (size_t i = 0; i < k && i + j + k < size; ++i)
+					{
+						// Only elements within the same merge of two sorted blocks of size p are compared
+						if ((i + j) / (2 * p) == (i + j + k) / (2 * p))
+						{
+							if (comparators != nullptr)
+							{
+								comparators[count] = { static_cast<uint8_t>(i + j), static_cast<uint8_t>(i + j + k) };
+							}
+							++count;
+						}
+					}
+				}
+			}
+		}
+		return count;
+	}
+
+	// Returns the maximum recursion depth of an introspective sort before it falls back to a heap sort (2 * log2(size))
+	static constexpr size_t SortDepthLimit(size_t size)
+	{
+		size_t depth = 0;
+		while (size > 1)
+		{
+			size >>= 1;
+			depth += 2;
+		}
+		return depth;
+	}
+
+	static constexpr bool s_radixSortable = std::is_arithmetic_v<T> && sizeof(T) <= 8 && (std::is_integral_v<T> || std::numeric_limits<T>::is_iec559); // Whether the element type can be sorted using a radix sort
+	static constexpr size_t s_radixSortThreshold = 256; // A radix sort will be performed if the array size is at least this threshold
+	static constexpr size_t s_countingSortThreshold = 1 << 16; // A counting sort will be performed for 16-bit types if the array size is at least this threshold
+	static constexpr bool s_networkSortable = std::is_trivially_copyable_v<T> && sizeof(T) <= 2 * sizeof(void*); // Whether the element type is cheap enough to copy to be sorted using a sorting network
+	static constexpr size_t s_maxNetworkSortSize = 32; // The maximum number of elements that can be sorted using a sorting network
+	static constexpr size_t s_nintherThreshold = 128; // The pivot will be the median of three medians of three if the array size is at least this threshold
+	static constexpr size_t s_heapSelectRatio = 8; // A heap will be used to select elements if the count is at most this fraction of the range
+	static constexpr size_t s_maxMergeRuns = 128; // The maximum number of runs on the merge sort stack, which grows logarithmically with the array size
+	static constexpr size_t s_searchPrefetchThreshold = 4096 / sizeof(T); // A binary search will prefetch the next elements while the range is larger than this threshold (4 KB)
+	static constexpr size_t s_searchBatchSize = 32; // The number of binary searches interleaved by a batched search
+	static constexpr size_t s_parallelChunkSize = 1 << 16; // The number of elements in each chunk of a parallel algorithm that can stop early, and the minimum for one that cannot
+	static constexpr size_t s_unsequencedBlockSize = 64; // The number of elements checked at once by a parallel unsequenced search
+	static constexpr size_t s_shuffleBlockSize = 1 << 16; // A parallel shuffle will shuffle blocks of at least this many elements before merging them
+	static constexpr size_t s_defaultInsertionSortThreshold = 10; // By default, an insertion sort will be performed if the array size is less than this threshold
+	static constexpr size_t s_defaultParallelSortThreshold = 1 << 14; // By default, a parallel sort will sort sub-arrays sequentially if they are smaller than this threshold
+	static constexpr size_t s_maxSize = std::numeric_limits<size_t>::max(); // The maximum size of the array
+	static constexpr BoundsChecking s_boundsChecking = BoundsChecking::ARRAY_BOUNDS_CHECKING; // How indices and ranges are checked against the bounds of the array
+
+	friend class ArrayAdapter<T, Derived>;
+
+	template<typename, typename, typename, LazyStages>
+	friend class LazyArray;
+};
+
+// Runtime interface for arrays, for code that needs to accept any kind of array without being a template
+// Note: Every element access is a virtual call, so prefer taking an ArrayBase<T, Derived> in performance critical code.
+template<typename T>
+class Array : public ArrayBase<T, Array<T>>
+{
+public:
+	// Default destructor
+	virtual ~Array() = default;
+
+	// Deep copies the elements from the raw array
+	virtual bool Copy(const T* data, const size_t size, const size_t offset = 0) = 0;
+
+	// Returns a pointer to the first element of the array
+	virtual T* Data() = 0;
+
+	// Returns a pointer to the first element of the array (const version)
+	virtual const T* Data() const = 0;
+
+	// Fills the array with the given value
+	virtual bool Fill(const T& value = T{}, const size_t from = 0, const size_t to = ArrayBase<T, Array<T>>::MaxSize()) = 0;
+
+	// Fills the array with the given value using the given execution policy
+	virtual bool Fill(const ExecutionPolicy policy, const T& value = T{}, const size_t from = 0, const size_t to = ArrayBase<T, Array<T>>::MaxSize()) = 0;
+
+	// Moves the elements from the raw array
+	virtual bool Move(T* data, const size_t size, const size_t offset = 0) = 0;
+
+	// Removes all elements from the array
+	virtual bool RemoveAll() = 0;
+
+	// Returns the size of the array
+	virtual const size_t Size() const = 0;
+
+protected:
+	// The index used for bounds checks
+	virtual size_t Bounds() const = 0;
+
+	friend class ArrayBase<T, Array<T>>;
+};
+
+// Adapts an array to the runtime Array interface by forwarding to it, without copying its elements
+// Note: The adapter refers to the array, so it must not outlive it.
+template<typename T, typename Derived>
+class ArrayAdapter final : public Array<T>
+{
+public:
+	// Constructor with the array to adapt
+	ArrayAdapter(ArrayBase<T, Derived>& array) : m_array(static_cast<Derived&>(array)) {}
+
+	// Deep copies the elements from the raw array
+	bool Copy(const T* data, const size_t size, const size_t offset = 0) override
+	{
+		return m_array.Copy(data, size, offset);
+	}
+
+	// Returns a pointer to the first element of the array
+	T* Data() override
+	{
+		return m_array.Data();
+	}
+
+	// Returns a pointer to the first element of the array (const version)
+	const T* Data() const override
+	{
+		return m_array.Data();
+	}
+
+	// Fills the array with the given value
+	bool Fill(const T& value = T{}, const size_t from = 0, const size_t to = Array<T>::MaxSize()) override
+	{
+		return m_array.Fill(value, from, to);
+	}
+
+	// Fills the array with the given value using the given execution policy
+	bool Fill(const ExecutionPolicy policy, const T& value = T{}, const size_t from = 0, const size_t to = Array<T>::MaxSize()) override
+	{
+		return m_array.Fill(policy, value, from, to);
+	}
+
+	// Moves the elements from the raw array
+	bool Move(T* data, const size_t size, const size_t offset = 0) override
+	{
+		return m_array.Move(data, size, offset);
+	}
+
+	// Removes all elements from the array
+	bool RemoveAll() override
+	{
+		return m_array.RemoveAll();
+	}
+
+	// Returns the size of the array
+	const size_t Size() const override
+	{
+		return m_array.Size();
+	}
+
+private:
+	// The index used for bounds checks
+	size_t Bounds() const override
+	{
+		return m_array.Bounds();
+	}
+
+	Derived& m_array; // The adapted array
 };
 
 // Equality operator with c-style array
-template <typename T, size_t N>
-bool operator==(const T(&left)[N], const Array<T>& right)
+template <typename T, typename Derived, size_t N>
+bool operator==(const T(&left)[N], const ArrayBase<T, Derived>& right)
 {
 	return right == left;
 }
 
 // Inequality operator with c-style array
-template <typename T, size_t N>
-bool operator!=(const T(&left)[N], const Array<T>& right)
+template <typename T, typename Derived, size_t N>
+bool operator!=(const T(&left)[N], const ArrayBase<T, Derived>& right)
 {
 	return !(right == left);
 }
\ No newline at end of file
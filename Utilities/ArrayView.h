@@ -0,0 +1,90 @@
+/*
+ * ArrayView.h
+ *
+ * This custom array view refers to a contiguous range of elements owned by another array, such as a Static Array, a Dynamic Array, a c-style array or a raw buffer.
+ * It provides the same methods as the other arrays (e.g. sorting, searching and replacing elements) without copying or allocating, so it can be used to work on a slice of an array.
+ * 
+ * A view of const elements (ArrayView<const T>) only allows the elements to be read. The view does not own the elements, so it must not outlive them,
+ * and a view into a Dynamic Array is invalidated when the Dynamic Array is resized.
+ *
+ * DISCLAIMER: This implementation is intended for portfolio/education purposes only.
+ * For production use, it is recommended to use std::span instead.
+ *
+ *  Copyright Peter Hoghton. All rights reserved.
+ */
+
+#pragma once
+
+#include "Array.h"
+
+template <typename T>
+class ArrayView final : public ArrayBase<T, ArrayView<T>>
+{
+	using Base = ArrayBase<T, ArrayView<T>>;
+
+public:
+	using Base::Fill;
+
+	// Default constructor - an empty view
+	ArrayView() : ArrayView(nullptr, 0) {}
+
+	// Copy constructor - refers to the same elements as the other view
+	ArrayView(const ArrayView& other) = default;
+
+	// Conversion constructor from other Array
+	template<typename OtherDerived>
+	ArrayView(ArrayBase<T, OtherDerived>& other) : ArrayView(other.Data(), other.Size()) {}
+
+	// Conversion constructor from other Array (const version) - only for views of const elements
+	template<typename OtherDerived>
+	ArrayView(const ArrayBase<std::remove_const_t<T>, OtherDerived>& other) requires std::is_const_v<T> : ArrayView(other.Data(), other.Size()) {}
+
+	// Conversion constructor from c-style array
+	template <size_t N>
+	ArrayView(T(&other)[N]) : ArrayView(other, N) {}
+
+	// Conversion constructor from raw array
+	ArrayView(T* data, const size_t size) : m_data(data), m_size(size) {}
+
+	// Default destructor
+	~ArrayView() = default;
+
+	// Copy assignment operator - refers to the same elements as the other view
+	ArrayView& operator=(const ArrayView& other) = default;
+
+	// Returns a pointer to the first element of the view
+	T* Data()
+	{
+		return m_data;
+	}
+
+	// Returns a pointer to the first element of the view (const version)
+	const T* Data() const
+	{
+		return m_data;
+	}
+
+	// Resets all elements of the view to default values, as the view cannot remove the elements it refers to
+	bool RemoveAll()
+	{
+		return Fill();
+	}
+
+	// Returns the size of the view
+	const size_t Size() const
+	{
+		return m_size;
+	}
+
+private:
+	T* m_data; // Pointer to the first element of the view
+	size_t m_size; // Size of the view
+};
+
+// Deduction guide for views of other Arrays
+template <typename T, typename Derived>
+ArrayView(ArrayBase<T, Derived>&) -> ArrayView<T>;
+
+// Deduction guide for views of const Arrays
+template <typename T, typename Derived>
+ArrayView(const ArrayBase<T, Derived>&) -> ArrayView<const T>;
@@ -16,103 +16,207 @@
 
 #include "Array.h"
 
-template <typename T>
-class DynamicArray final : public Array<T>
+#include <cstdlib>
+#include <new>
+
+// MSVC ignores the standard attribute to keep its ABI stable, but provides its own
+#if defined(_MSC_VER)
+#define DYNAMIC_ARRAY_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define DYNAMIC_ARRAY_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
+// Whether objects of the type can be relocated by copying their bytes, instead of move constructing them and destroying the originals
+// Note: Specialize this for types that don't point into themselves, so that Dynamic Arrays of them can grow using realloc.
+template<typename T>
+struct TriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+// Standard allocators have no state, but may not be trivially copyable as they declare their copy constructors
+template<typename T>
+struct TriviallyRelocatable<std::allocator<T>> : std::true_type {};
+
+// Dynamic Arrays only point to their elements, which are stored elsewhere, so they are relocatable if their allocator is
+// Note: Small Arrays may point into their own inline storage, so they are never relocatable.
+template<typename T, typename Allocator, size_t InlineCapacity>
+struct TriviallyRelocatable<DynamicArray<T, Allocator, InlineCapacity>> : std::bool_constant<InlineCapacity == 0 && TriviallyRelocatable<Allocator>::value> {};
+
+// Uninitialized storage for the elements of a Small Array (see SmallArray.h) that fit inside the array itself
+template<typename T, size_t Capacity>
+struct InlineStorage
 {
+	// Returns a pointer to the first element
+	T* Data()
+	{
+		return reinterpret_cast<T*>(m_bytes);
+	}
+
+	alignas(T) unsigned char m_bytes[Capacity * sizeof(T)]; // The storage, which elements are constructed in as they are added
+};
+
+// Dynamic Arrays without inline storage take no extra space
+template<typename T>
+struct InlineStorage<T, 0>
+{
+	// Returns nullptr, which is the storage of an empty Dynamic Array
+	T* Data()
+	{
+		return nullptr;
+	}
+};
+
+// Note: The allocator defaults to std::allocator, see Allocators.h for arena and pool allocators.
+// Elements up to the inline capacity are stored inside the array itself rather than allocated, see SmallArray.h.
+template <typename T, typename Allocator, size_t InlineCapacity>
+class DynamicArray final : public ArrayBase<T, DynamicArray<T, Allocator, InlineCapacity>>
+{
+	using Base = ArrayBase<T, DynamicArray<T, Allocator, InlineCapacity>>;
+	using AllocatorTraits = std::allocator_traits<Allocator>;
+
 public:
-	using Array<T>::BoundsCheck;
-	using Array<T>::Contains;
-	using Array<T>::MaxSize;
+	using Base::BoundsCheck;
+	using Base::Contains;
+	using Base::MaxSize;
 
 	// Default constructor
 	DynamicArray() : DynamicArray(0) {}
 
+	// Constructor with allocator argument
+	explicit DynamicArray(const Allocator& allocator) : DynamicArray(0, allocator) {}
+
 	// Constructor with capacity argument
-	DynamicArray(const size_t capacity) 
+	// Note: The capacity is never less than the inline capacity.
+	DynamicArray(const size_t capacity, const Allocator& allocator = Allocator()) : m_allocator(allocator)
 	{
-		Init(nullptr, 0, capacity);
+		Init(Allocate(capacity), 0, (capacity > InlineCapacity) ? capacity : InlineCapacity);
 	}
 
 	// Copy constructor
-	DynamicArray(const DynamicArray& other) : DynamicArray(other.m_data, other.m_size) {}
+	DynamicArray(const DynamicArray& other) : DynamicArray(other.m_data, other.m_size, AllocatorTraits::select_on_container_copy_construction(other.m_allocator)) {}
 
 	// Move constructor
-	DynamicArray(DynamicArray&& other) noexcept : DynamicArray(other.m_data, other.m_size, true) 
+	// Note: The storage is taken from the other array, which is left empty, so no elements are moved unless they are in the other array's inline storage.
+	DynamicArray(DynamicArray&& other) noexcept(InlineCapacity == 0 || std::is_nothrow_move_constructible_v<T>) : m_allocator(std::move(other.m_allocator))
 	{
-		other.Resize(0);
+		if (other.IsInline())
+		{
+			Init(m_inline.Data(), 0, InlineCapacity);
+			Construct(m_data, other.m_data, other.m_size, true);
+			m_size = other.m_size;
+			other.Truncate(0);
+		}
+		else
+		{
+			Init(other.m_data, other.m_size, other.m_capacity);
+			other.Init(other.m_inline.Data(), 0, InlineCapacity);
+		}
 	}
 
 	// Conversion copy constructor from other Array
-	DynamicArray(const Array<T>& other) : DynamicArray(other.Data(), other.Size()) {}
+	template<typename OtherDerived>
+	DynamicArray(const ArrayBase<T, OtherDerived>& other, const Allocator& allocator = Allocator()) : DynamicArray(other.Data(), other.Size(), allocator) {}
 
 	// Conversion move constructor from other Array
-	DynamicArray(Array<T>&& other) : DynamicArray(other.Data(), other.Size(), true) {}
+	template<typename OtherDerived>
+	DynamicArray(ArrayBase<T, OtherDerived>&& other, const Allocator& allocator = Allocator()) : DynamicArray(other.Data(), other.Size(), true, allocator) {}
 	
 	// Conversion copy constructor from initializer list
-	DynamicArray(const std::initializer_list<T>& list) : DynamicArray(list.begin(), list.size()) {}
+	DynamicArray(const std::initializer_list<T>& list, const Allocator& allocator = Allocator()) : DynamicArray(list.begin(), list.size(), allocator) {}
 
 	// Conversion copy constructor from c-style array
 	template <size_t N>
-	DynamicArray(const T(&other)[N]) : DynamicArray(other, N) {}
+	DynamicArray(const T(&other)[N], const Allocator& allocator = Allocator()) : DynamicArray(other, N, allocator) {}
 
 	// Conversion copy constructor from raw array
-	DynamicArray(const T* data, const size_t size)
+	DynamicArray(const T* data, const size_t size, const Allocator& allocator = Allocator()) : DynamicArray(size, allocator)
 	{
-		Init(size);
-		Copy(data, size);
+		Construct(m_data, const_cast<T*>(data), size, false);
+		m_size = size;
 	}
 
 	// Conversion copy/move constructor from raw array
-	DynamicArray(T* data, const size_t size, const bool move = false)
+	DynamicArray(T* data, const size_t size, const bool move = false, const Allocator& allocator = Allocator()) : DynamicArray(size, allocator)
 	{
-		Init(size);
-		move ? Move(data, size) : Copy(data, size);
+		Construct(m_data, data, size, move);
+		m_size = size;
 	}
 
 	// Default destructor
 	~DynamicArray()
 	{
-		delete[] m_data;
+		Destroy(0, m_size);
+		Deallocate(m_data, m_capacity);
 	}
 
 	// Copy assignment operator
 	DynamicArray& operator=(const DynamicArray& other)
 	{	
-		Init(other.m_size);
-		Copy(other.Data(), other.m_size);	
+		if (this != &other)
+		{
+			if constexpr (AllocatorTraits::propagate_on_container_copy_assignment::value)
+			{
+				// The storage must be freed by the allocator that allocated it before the allocator is replaced
+				if (m_allocator != other.m_allocator)
+				{
+					Release();
+				}
+				m_allocator = other.m_allocator;
+			}
+			Assign(other.m_data, other.m_size, false);
+		}
 		return *this;
 	}
 
 	// Move assignment operator
-	DynamicArray& operator=(DynamicArray&& other) noexcept
+	// Note: The storage is taken from the other array, which is left empty, so no elements are moved.
+	// If the elements are in the other array's inline storage, or the allocators differ and can't be propagated, they are moved into this array's storage instead.
+	DynamicArray& operator=(DynamicArray&& other) noexcept((AllocatorTraits::propagate_on_container_move_assignment::value || AllocatorTraits::is_always_equal::value) && (InlineCapacity == 0 || std::is_nothrow_move_constructible_v<T>))
 	{
-		Init(other.m_size);
-		Move(other.Data(), other.m_size);
-		other.Resize(0);
+		if (this != &other)
+		{
+			bool moveElements = other.IsInline();
+			if constexpr (!AllocatorTraits::propagate_on_container_move_assignment::value && !AllocatorTraits::is_always_equal::value)
+			{
+				moveElements = moveElements || m_allocator != other.m_allocator;
+			}
+
+			if (moveElements)
+			{
+				Assign(other.m_data, other.m_size, true);
+				other.Release();
+				return *this;
+			}
+
+			Release();
+			if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value)
+			{
+				m_allocator = std::move(other.m_allocator);
+			}
+			Init(other.m_data, other.m_size, other.m_capacity);
+			other.Init(other.m_inline.Data(), 0, InlineCapacity);
+		}
 		return *this;
 	}
 
 	// Conversion copy assignment operator from other Array
-	DynamicArray& operator=(const Array<T>& other)
+	template<typename OtherDerived>
+	DynamicArray& operator=(const ArrayBase<T, OtherDerived>& other)
 	{
-		Init(other.Size());
-		Copy(other.Data(), other.Size());
+		Assign(const_cast<T*>(other.Data()), other.Size(), false);
 		return *this;
 	}
 
 	// Conversion move assignment operator from other Array
-	DynamicArray& operator=(Array<T>&& other)
+	template<typename OtherDerived>
+	DynamicArray& operator=(ArrayBase<T, OtherDerived>&& other)
 	{
-		Init(other.Size());
-		Move(other.Data(), other.Size());
+		Assign(other.Data(), other.Size(), true);
 		return *this;
 	}
 
 	// Conversion copy assignment operator from initializer list
 	DynamicArray& operator=(const std::initializer_list<T>& list)
 	{
-		Init(list.size());
-		Copy(list.begin(), list.size());
+		Assign(const_cast<T*>(list.begin()), list.size(), false);
 		return *this;
 	}
 
@@ -120,20 +224,20 @@ public:
 	template <size_t N>
 	DynamicArray& operator=(const T(&other)[N])
 	{
-		Init(N);
-		Copy(other, N);
+		Assign(const_cast<T*>(other), N, false);
 		return *this;
 	}
 
 	// Addition assignment operator - concatenates the Dynamic Array and another Array
-	DynamicArray<T>& operator+=(const Array<T>& other)
+	template<typename OtherDerived>
+	DynamicArray& operator+=(const ArrayBase<T, OtherDerived>& other)
 	{
 		Add(other);
 		return *this;
 	}
 
 	// Addition assignment operator - concatenates the Dynamic Array and an initializer list
-	DynamicArray<T>& operator+=(const std::initializer_list<T>& list)
+	DynamicArray& operator+=(const std::initializer_list<T>& list)
 	{
 		Add(list.begin(), list.size());
 		return *this;
@@ -141,26 +245,26 @@ public:
 
 	// Addition assignment operator - concatenates the Dynamic Array and a c-style array
 	template <size_t N>
-	DynamicArray<T>& operator+=(const T(&other)[N])
+	DynamicArray& operator+=(const T(&other)[N])
 	{
 		Add(other);
 		return *this;
 	}
 
 	// Addition operator - concatenates two Arrays
-	template <typename T>
-	friend DynamicArray<T> operator+(const Array<T>& left, const Array<T>& right);
+	template <typename T, typename LeftDerived, typename RightDerived>
+	friend DynamicArray<T> operator+(const ArrayBase<T, LeftDerived>& left, const ArrayBase<T, RightDerived>& right);
 
 	// Addition operator - concatenates a Dynamic Array and a c-style array
 	template <size_t N>
-	DynamicArray<T> operator+(const T(&other)[N]) const
+	DynamicArray operator+(const T(&other)[N]) const
 	{
-		return Concatenate(m_data, m_size, other, N);
+		return Concatenate(m_data, m_size, other, N, AllocatorTraits::select_on_container_copy_construction(m_allocator));
 	}
 
 	// Addition operator - concatenates a c-style array and a Dynamic Array
-	template <typename T, size_t N>
-	friend DynamicArray<T> operator+(const T(&left)[N], const DynamicArray<T>& right);
+	template <typename U, typename A, size_t I, size_t N>
+	friend DynamicArray<U, A, I> operator+(const U(&left)[N], const DynamicArray<U, A, I>& right);
 
 	// Adds an element to the end of the array
 	void Add(const T& element)
@@ -169,7 +273,8 @@ public:
 	}
 
 	// Adds another Array to the end of the array
-	bool Add(const Array<T>& other)
+	template<typename OtherDerived>
+	bool Add(const ArrayBase<T, OtherDerived>& other)
 	{
 		return Add(other.Data(), other.Size());
 	}
@@ -200,21 +305,20 @@ public:
 	}
 
 	// Deep copies the elements from the raw array
-	// Note: Remaining elements are left uninitialized.
-	bool Copy(const T* data, const size_t size, const size_t offset = 0) override
+	// Note: The array grows to fit if necessary, and any elements between its previous size and the offset are default initialized.
+	bool Copy(const T* data, const size_t size, const size_t offset = 0)
 	{
-		const bool dirty = PreCopyOrMove(size, offset);
-		return Array<T>::Copy(data, size, offset) || dirty;
+		return CopyOrMove(const_cast<T*>(data), size, offset, false);
 	}
 
 	// Returns a pointer to the first element of the array
-	T* Data() override
+	T* Data()
 	{
 		return m_data;
 	}
 
 	// Returns a pointer to the first element of the array (const version)
-	const T* Data() const override
+	const T* Data() const
 	{
 		return m_data;
 	}
@@ -231,29 +335,39 @@ public:
 	void EmplaceAt(const size_t index, Args&&... args)
 	{
 		Grow(index);
-		m_data[index] = T(std::forward<Args>(args)...);
+		std::construct_at(m_data + index, std::forward<Args>(args)...);
 		++m_size;
 	}
 
 	// Fills the array with the given value
-	// Note: Remaining elements are left uninitialized.
-	bool Fill(const T& value = T{}, const size_t from = 0, const size_t to = MaxSize()) override
+	// Note: By default the array is filled up to its capacity. It grows to fit if necessary, and any elements between its previous size and the range are default initialized.
+	bool Fill(const T& value = T{}, const size_t from = 0, const size_t to = MaxSize())
+	{
+		const size_t size = (to == MaxSize()) ? m_capacity : to;
+		const size_t constructed = PreFill(value, from, size);
+		return (constructed > from && Base::Fill(value, from, constructed)) || size > constructed;
+	}
+
+	// Fills the array with the given value using the given execution policy
+	// Note: By default the array is filled up to its capacity. It grows to fit if necessary, and any elements between its previous size and the range are default initialized.
+	bool Fill(const ExecutionPolicy policy, const T& value = T{}, const size_t from = 0, const size_t to = MaxSize())
 	{
 		const size_t size = (to == MaxSize()) ? m_capacity : to;
-		const bool dirty = PreCopyOrMove(size - from, from);
-		return Array<T>::Fill(value, from, to) || dirty;
+		const size_t constructed = PreFill(value, from, size);
+		return (constructed > from && Base::Fill(policy, value, from, constructed)) || size > constructed;
 	}
 
 	// Inserts an element at the specified index
 	void Insert(const size_t index, const T& element)
 	{
 		Grow(index);
-		m_data[index] = element;
+		std::construct_at(m_data + index, element);
 		++m_size;
 	}
 
 	// Inserts another Array at the specified index
-	bool Insert(const size_t index, const Array<T>& other)
+	template<typename OtherDerived>
+	bool Insert(const size_t index, const ArrayBase<T, OtherDerived>& other)
 	{
 		return Insert(index, other.Data(), other.Size());
 	}
@@ -269,12 +383,7 @@ public:
 	bool Insert(const size_t index, const T* data, const size_t size)
 	{
 		Grow(index, size);
-
-		for (size_t i = 0; i < size; ++i)
-		{
-			m_data[index + i] = data[i];
-		}
-
+		Construct(m_data + index, const_cast<T*>(data), size, false);
 		m_size += size;
 
 		return size > 0;
@@ -292,67 +401,43 @@ public:
 	}
 
 	// Moves the elements from the raw array
-	// Note: Remaining elements are left uninitialized.
-	bool Move(T* data, const size_t size, const size_t offset = 0) override
+	// Note: The array grows to fit if necessary, and any elements between its previous size and the offset are default initialized.
+	bool Move(T* data, const size_t size, const size_t offset = 0)
 	{
-		const bool dirty = PreCopyOrMove(size, offset);
-		return Array<T>::Move(data, size, offset) || dirty;
+		return CopyOrMove(data, size, offset, true);
 	}
 
 	// Removes all occurrences of the given value from the array
+	// Note: Arithmetic element types are removed using vectorized instructions.
 	bool Remove(const T& value)
 	{
-		return Remove([&](const T& element) { return element == value; });
+		if constexpr (Simd::Arithmetic<T>)
+		{
+			return Truncate(Simd::Remove(m_data, m_size, value));
+		}
+		else
+		{
+			// The value is copied first as it may be an element of the array, which could be overwritten
+			const T copy = value;
+			return RemoveIf([&](const T& element) { return element == copy; }) > 0;
+		}
 	}
 
 	// Removes all occurrences of nullptr from the array
 	bool Remove(std::nullptr_t)
 	{
-		return Remove([](const T& element) { return element == nullptr; });
+		return RemoveIf([](const T& element) { return element == nullptr; }) > 0;
 	}
 
 	// Removes all elements that satisfy the predicate from the array
 	template<typename Predicate>
 	bool Remove(const Predicate& predicate)
 	{
-		size_t count = 0;
-
-		for (size_t i = 0; i < m_size; ++i)
-		{
-			if (predicate(m_data[i]))
-			{
-				++count;
-			}
-		}
-
-		if (count == 0)
-		{
-			return false;
-		}
-
-		T* newData = new T[m_size - count];
-
-		size_t index = 0;
-
-		for (size_t i = 0; i < m_size; ++i)
-		{
-			if (!predicate(m_data[i]))
-			{
-				newData[index++] = m_data[i];
-			}
-		}
-
-		delete[] m_data;
-		m_data = newData;
-		m_size -= count;
-
-		Shrink();
-
-		return true;
+		return RemoveIf(predicate) > 0;
 	}
 
 	// Removes all elements from the array
-	bool RemoveAll() override
+	bool RemoveAll()
 	{
 		return Resize(0);
 	}
@@ -363,23 +448,71 @@ public:
 		RemoveRange(index, index);
 	}
 
-	// Removes all duplicate elements from the array
+	// Removes all duplicate elements from the array, keeping the first occurrence of each in its original order
+	// Note: Hashable element types are deduplicated in O(n) using a hash table, and other types that can be compared with operator< in O(n log n) by sorting their indices.
 	bool RemoveDuplicates()
 	{
-		DynamicArray<T> result(m_size);
+		if constexpr (s_hashable)
+		{
+			if (m_size < std::numeric_limits<uint32_t>::max())
+			{
+				return RemoveHashedDuplicates<uint32_t>(); // Halves the size of the hash table
+			}
+			return RemoveHashedDuplicates<size_t>();
+		}
+		else if constexpr (s_lessThanComparable)
+		{
+			return RemoveSortedDuplicates();
+		}
+		else
+		{
+			size_t index = 0;
 
-		for (size_t i = 0; i < m_size; ++i)
+			for (size_t i = 0; i < m_size; ++i)
+			{
+				if (std::find(m_data, m_data + index, m_data[i]) == m_data + index)
+				{
+					if (index != i)
+					{
+						m_data[index] = std::move(m_data[i]);
+					}
+					++index;
+				}
+			}
+
+			return Truncate(index);
+		}
+	}
+
+	// Removes all elements that satisfy the predicate from the array, and returns the number of elements removed
+	// Note: The remaining elements are moved forward in a single pass keeping their order, and the capacity is left unchanged (see Trim).
+	template<typename Predicate>
+	size_t RemoveIf(const Predicate& predicate)
+	{
+		size_t index = 0;
+		while (index < m_size && !predicate(m_data[index]))
 		{
-			result.AddUnique(m_data[i]);
+			++index;
 		}
 
-		if (result.m_size < m_size)
+		for (size_t i = index + 1; i < m_size; ++i)
 		{
-			*this = std::move(result);
-			return true;
+			if constexpr (std::is_trivially_copyable_v<T>)
+			{
+				// Every element is copied so that the loop has no branches
+				const T element = m_data[i];
+				m_data[index] = element;
+				index += predicate(element) ? 0 : 1;
+			}
+			else if (!predicate(m_data[i]))
+			{
+				m_data[index++] = std::move(m_data[i]);
+			}
 		}
 
-		return false;
+		const size_t count = m_size - index;
+		Truncate(index);
+		return count;
 	}
 
 	// Remove the elements within the specified range from the array
@@ -392,9 +525,15 @@ public:
 		if (count > 0 && from < m_size)
 		{
 			count = (count < m_size - from) ? count : m_size - from;
-			for (size_t i = from + count; i < m_size; ++i)
+			if constexpr (s_relocatable)
 			{
-				m_data[i - count] = m_data[i];
+				Destroy(from, from + count);
+				Simd::Copy(m_data + from, m_data + from + count, (m_size - from - count) * sizeof(T));
+			}
+			else
+			{
+				std::move(m_data + from + count, m_data + m_size, m_data + from);
+				Destroy(m_size - count, m_size);
 			}
 			m_size -= count;
 			Shrink();
@@ -405,33 +544,87 @@ public:
 	}
 
 	// Resizes the array to the specified capacity
+	// Note: Only the elements are constructed, the remaining capacity is left as uninitialized storage. The capacity is never less than the inline capacity.
+	// Trivially relocatable elements are moved by realloc, which can often grow the storage in place (large blocks are remapped rather than copied on Linux).
 	bool Resize(const size_t capacity)
 	{
-		if (capacity == m_capacity)
+		const size_t newCapacity = (capacity > InlineCapacity) ? capacity : InlineCapacity;
+		if (newCapacity == m_capacity)
 		{
-			return false;
+			return Truncate(capacity);
 		}
 
-		T* newData = (capacity == 0) ? nullptr : new T[capacity];
+		const size_t newSize = (m_size < capacity) ? m_size : capacity;
 
-		size_t newSize = (m_size < capacity) ? m_size : capacity;
-		for (size_t i = 0; i < newSize; ++i)
+		if constexpr (s_reallocatable)
 		{
-			newData[i] = m_data[i];
+			if (m_data != m_inline.Data() && newCapacity > InlineCapacity)
+			{
+				if (newCapacity > MaxSize() / sizeof(T))
+				{
+					throw std::bad_array_new_length();
+				}
+
+				// Note: The elements past the new capacity must be destroyed before realloc frees them, so the size is updated in case it throws.
+				Truncate(newSize);
+
+				// Note: The cast tells the compiler that relocating the elements bytewise is intended.
+				T* newData = static_cast<T*>(std::realloc(static_cast<void*>(m_data), newCapacity * sizeof(T)));
+				if (newData == nullptr)
+				{
+					throw std::bad_alloc();
+				}
+				Init(newData, newSize, newCapacity);
+				return true;
+			}
 		}
 
-		delete[] m_data;
-		Init(newData, newSize, capacity);
+		// Note: The old storage is only released once the elements have been moved, so the array is unchanged if allocating or moving throws.
+		T* newData = Allocate(newCapacity);
+		try
+		{
+			std::uninitialized_move_n(m_data, newSize, newData);
+		}
+		catch (...)
+		{
+			Deallocate(newData, newCapacity);
+			throw;
+		}
 
+		Destroy(0, m_size);
+		Deallocate(m_data, m_capacity);
+		Init(newData, newSize, newCapacity);
 		return true;
 	}
 
 	// Returns the size of the array
-	const size_t Size() const override
+	const size_t Size() const
 	{
 		return m_size;
 	}
 
+	// Sorts the array in ascending order and removes all duplicate elements in place
+	// Note: Unlike RemoveDuplicates, the original order of the elements is not kept, but no additional memory is needed.
+	bool SortedUnique()
+	{
+		const bool dirty = Base::Sort();
+		size_t index = (m_size > 0) ? 1 : 0;
+
+		for (size_t i = 1; i < m_size; ++i)
+		{
+			if (!(m_data[i] == m_data[index - 1]))
+			{
+				if (index != i)
+				{
+					m_data[index] = std::move(m_data[i]);
+				}
+				++index;
+			}
+		}
+
+		return Truncate(index) || dirty;
+	}
+
 	// Trims the capacity of the array to fit its contents
 	bool Trim()
 	{
@@ -439,10 +632,66 @@ public:
 	}
 
 private:
+	// Allocates uninitialized storage for the given number of elements
+	// Note: The inline storage is used if it is large enough, which is nullptr for an empty array without inline storage.
+	T* Allocate(const size_t capacity)
+	{
+		if (capacity <= InlineCapacity)
+		{
+			return m_inline.Data();
+		}
+
+		if constexpr (s_reallocatable)
+		{
+			if (capacity > MaxSize() / sizeof(T))
+			{
+				throw std::bad_array_new_length();
+			}
+
+			void* data = std::malloc(capacity * sizeof(T));
+			if (data == nullptr)
+			{
+				throw std::bad_alloc();
+			}
+			return static_cast<T*>(data);
+		}
+		else
+		{
+			return AllocatorTraits::allocate(m_allocator, capacity);
+		}
+	}
+
+	// Replaces the elements with those from the raw array, reusing the storage if it is large enough
+	// Note: The raw array may be a view of this array, so the existing elements are assigned to rather than destroyed first.
+	void Assign(T* data, const size_t size, const bool move)
+	{
+		if (size > m_capacity)
+		{
+			T* newData = Allocate(size);
+			try
+			{
+				Construct(newData, data, size, move);
+			}
+			catch (...)
+			{
+				Deallocate(newData, size);
+				throw;
+			}
+
+			Destroy(0, m_size);
+			Deallocate(m_data, m_capacity);
+			Init(newData, size, size);
+			return;
+		}
+
+		CopyOrMove(data, size, 0, move);
+		Truncate(size);
+	}
+
 	// Concatenates the two arrays and returns the result
-	static DynamicArray<T> Concatenate(const T* left, const size_t leftSize, const T* right, const size_t rightSize)
+	static DynamicArray Concatenate(const T* left, const size_t leftSize, const T* right, const size_t rightSize, const Allocator& allocator = Allocator())
 	{
-		DynamicArray<T> result(leftSize + rightSize);
+		DynamicArray result(leftSize + rightSize, allocator);
 
 		result.Copy(left, leftSize);
 		result.Copy(right, rightSize, leftSize);
@@ -450,18 +699,104 @@ private:
 		return result;
 	}
 
-	// The index used for bounds checks
-	size_t Bounds() const override
+	// Copy or move constructs elements from the raw array into the uninitialized storage at the destination
+	static void Construct(T* destination, T* data, const size_t size, const bool move)
 	{
-		return m_capacity;
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			Simd::Copy(destination, data, size * sizeof(T));
+		}
+		else if (move)
+		{
+			std::uninitialized_move_n(data, size, destination);
+		}
+		else
+		{
+			std::uninitialized_copy_n(data, size, destination);
+		}
+	}
+
+	// Default initializes the elements from the end of the array up to the specified size
+	// Note: Types that can't be default constructed can only be added to the end of the array.
+	bool ConstructDefault(const size_t size)
+	{
+		if (size <= m_size)
+		{
+			return false;
+		}
+
+		if constexpr (std::is_default_constructible_v<T>)
+		{
+			std::uninitialized_default_construct(m_data + m_size, m_data + size);
+			m_size = size;
+			return true;
+		}
+		else
+		{
+			throw std::out_of_range("Array index out of bounds");
+		}
+	}
+
+	// Copies or moves the elements from the raw array, assigning to existing elements and constructing the rest
+	bool CopyOrMove(T* data, const size_t size, const size_t offset, const bool move)
+	{
+		if (data == m_data + offset && offset + size <= m_size) // Check for self-assignment
+		{
+			return false;
+		}
+
+		bool dirty = Reserve(offset + size);
+		dirty = ConstructDefault(offset) || dirty;
+
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			Simd::Copy(m_data + offset, data, size * sizeof(T));
+		}
+		else
+		{
+			const size_t assigned = (offset + size < m_size) ? size : m_size - offset;
+			move ? std::move(data, data + assigned, m_data + offset) : std::copy(data, data + assigned, m_data + offset);
+			Construct(m_data + offset + assigned, data + assigned, size - assigned, move);
+		}
+
+		m_size = (offset + size > m_size) ? offset + size : m_size;
+		return size > 0 || dirty;
+	}
+
+	// Frees storage allocated for the given number of elements
+	void Deallocate(T* data, const size_t capacity)
+	{
+		if (data == m_inline.Data())
+		{
+			return;
+		}
+
+		if constexpr (s_reallocatable)
+		{
+			std::free(data);
+		}
+		else
+		{
+			AllocatorTraits::deallocate(m_allocator, data, capacity);
+		}
+	}
+
+	// Destroys the elements within the specified range, leaving uninitialized storage
+	void Destroy(const size_t from, const size_t to)
+	{
+		if constexpr (!std::is_trivially_destructible_v<T>)
+		{
+			std::destroy(m_data + from, m_data + to);
+		}
 	}
 
 	// Grows the array from the specified index if necessary
+	// Note: The elements from the index onwards are shifted to make room, and the gap is left as uninitialized storage for the caller to construct.
 	bool Grow(const size_t index, const size_t amount = 1)
 	{
-		if (m_data == nullptr && m_capacity > 0)
+		if (index != m_size)
 		{
-			Init(new T[m_capacity], m_size, m_capacity);
+			BoundsCheck(index);
 		}
 
 		if (m_size + amount > m_capacity)
@@ -470,21 +805,25 @@ private:
 			Resize(m_size + amount > newCapacity ? m_size + amount : newCapacity);
 		}
 
-		for (size_t i = m_capacity - 1; i >= index + amount; --i)
+		if (index < m_size && amount > 0)
 		{
-			m_data[i] = std::move(m_data[i - amount]);
+			if constexpr (s_relocatable)
+			{
+				Simd::Copy(m_data + index + amount, m_data + index, (m_size - index) * sizeof(T));
+			}
+			else
+			{
+				// Elements shifted past the end are constructed in the uninitialized storage, and the rest are assigned
+				const size_t constructed = (amount < m_size - index) ? amount : m_size - index;
+				std::uninitialized_move(m_data + m_size - constructed, m_data + m_size, m_data + m_size + amount - constructed);
+				std::move_backward(m_data + index, m_data + m_size - constructed, m_data + m_size + amount - constructed);
+				Destroy(index, index + constructed);
+			}
 		}
-
 		return amount > 0;
 	}
 
-	// Initializes the array with default values
-	void Init(const size_t capacity = 0)
-	{
-		Init(capacity == 0 ? nullptr : new T[capacity], capacity, capacity);
-	}
-
-	// Initializes the array with default values
+	// Initializes the array
 	void Init(T* data, const size_t size, const size_t capacity)
 	{
 		m_data = data;
@@ -492,26 +831,132 @@ private:
 		m_capacity = capacity;
 	}
 
-	// Initializes and/or resizes the array prior to a copy/move if necessary
-	bool PreCopyOrMove(const size_t size, const size_t offset = 0)
+	// Returns whether the elements are in the inline storage
+	bool IsInline()
+	{
+		return InlineCapacity > 0 && m_data == m_inline.Data();
+	}
+
+	// Reserves storage and default initializes any elements before the range prior to a fill, and returns the end of the elements that were already constructed
+	size_t PreFill(const T& value, const size_t from, const size_t size)
+	{
+		if (from > size)
+		{
+			throw std::out_of_range("Array index out of bounds");
+		}
+
+		Reserve(size);
+		ConstructDefault(from);
+
+		const size_t constructed = (size < m_size) ? size : m_size;
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			// Trivial types don't need constructing, so the whole range is filled by the base version
+			m_size = (size > m_size) ? size : m_size;
+			return size;
+		}
+		else
+		{
+			std::uninitialized_fill(m_data + constructed, m_data + size, value);
+			m_size = (size > m_size) ? size : m_size;
+			return constructed;
+		}
+	}
+
+	// Destroys the elements and frees the storage, leaving the array empty
+	void Release()
+	{
+		Destroy(0, m_size);
+		Deallocate(m_data, m_capacity);
+		Init(m_inline.Data(), 0, InlineCapacity);
+	}
+
+	// Removes all duplicate elements from the array using an open addressing hash table of the indices of the kept elements
+	template<typename Index>
+	bool RemoveHashedDuplicates()
+	{
+		if (m_size < 2)
+		{
+			return false;
+		}
+
+		// Fibonacci hashing spreads the bits of identity hashes (such as std::hash for integers) across the table
+		const size_t slotCount = std::bit_ceil(m_size + m_size / 2);
+		const size_t mask = slotCount - 1;
+		const int shift = 64 - std::countr_zero(slotCount);
+		std::vector<Index> slots(slotCount, std::numeric_limits<Index>::max());
+		const std::hash<T> hash;
+
+		size_t index = 0;
+
+		for (size_t i = 0; i < m_size; ++i)
+		{
+			size_t slot = static_cast<size_t>((static_cast<uint64_t>(hash(m_data[i])) * s_hashMultiplier) >> shift);
+			while (slots[slot] != std::numeric_limits<Index>::max() && !(m_data[slots[slot]] == m_data[i]))
+			{
+				slot = (slot + 1) & mask;
+			}
+
+			if (slots[slot] == std::numeric_limits<Index>::max())
+			{
+				if (index != i)
+				{
+					m_data[index] = std::move(m_data[i]);
+				}
+				slots[slot] = static_cast<Index>(index++);
+			}
+		}
+
+		return Truncate(index);
+	}
+
+	// Removes all duplicate elements from the array by sorting their indices, so that the first occurrence of each is found in O(n log n)
+	bool RemoveSortedDuplicates()
 	{
-		bool dirty = false;
-		if (offset + size > m_capacity)
+		if (m_size < 2)
 		{
-			Resize(offset + size);
-			dirty = true;
+			return false;
 		}
-		if (offset + size > m_size)
+
+		DynamicArray<size_t> indices(m_size);
+		indices.Fill();
+		for (size_t i = 0; i < m_size; ++i)
 		{
-			m_size = offset + size;
-			dirty = true;
+			indices.Data()[i] = i;
 		}
-		if (m_data == nullptr && m_capacity > 0)
+
+		// Equal elements are ordered by index so that the first occurrence of each comes first
+		indices.Sort([&](const size_t left, const size_t right) { return m_data[left] < m_data[right] || (!(m_data[right] < m_data[left]) && left < right); });
+
+		DynamicArray<bool> keep(m_size);
+		keep.Fill(false);
+		keep.Data()[indices.Data()[0]] = true;
+		for (size_t i = 1; i < m_size; ++i)
 		{
-			m_data = new T[m_capacity];
-			dirty = true;
+			keep.Data()[indices.Data()[i]] = m_data[indices.Data()[i - 1]] < m_data[indices.Data()[i]];
 		}
-		return dirty;
+
+		size_t index = 0;
+
+		for (size_t i = 0; i < m_size; ++i)
+		{
+			if (keep.Data()[i])
+			{
+				if (index != i)
+				{
+					m_data[index] = std::move(m_data[i]);
+				}
+				++index;
+			}
+		}
+
+		return Truncate(index);
+	}
+
+	// Grows the capacity of the array to at least the specified size if necessary
+	bool Reserve(const size_t size)
+	{
+		return size > m_capacity && Resize(size);
 	}
 
 	// Shrinks the array if necessary
@@ -525,21 +970,42 @@ private:
 		return false;
 	}
 
+	// Reduces the size of the array to the given size without changing its capacity
+	// Note: Elements past the new size are destroyed so that any resources they hold are released.
+	bool Truncate(const size_t size)
+	{
+		if (size < m_size)
+		{
+			Destroy(size, m_size);
+			m_size = size;
+			return true;
+		}
+		return false;
+	}
+
+	static constexpr bool s_hashable = requires(const T& element) { { std::hash<T>{}(element) } -> std::convertible_to<size_t>; }; // Whether duplicates can be found using a hash table
+	static constexpr bool s_lessThanComparable = requires(const T& left, const T& right) { { left < right } -> std::convertible_to<bool>; }; // Whether duplicates can be found by sorting
+	static constexpr bool s_relocatable = TriviallyRelocatable<T>::value; // Whether elements can be moved within the storage by copying their bytes
+	static constexpr bool s_reallocatable = s_relocatable && alignof(T) <= alignof(std::max_align_t) && std::is_same_v<Allocator, std::allocator<T>>; // Whether the storage can be allocated using malloc and grown using realloc
+	static constexpr uint64_t s_hashMultiplier = 0x9E3779B97F4A7C15; // 2^64 divided by the golden ratio, used to spread hashes across the hash table
+
 	T* m_data; // Pointer to the first element of the array
 	size_t m_size; // Size of the array
 	size_t m_capacity; // Capacity of the array
+	DYNAMIC_ARRAY_NO_UNIQUE_ADDRESS Allocator m_allocator; // Allocator for the storage, which takes no space if it has no state
+	DYNAMIC_ARRAY_NO_UNIQUE_ADDRESS InlineStorage<T, InlineCapacity> m_inline; // Storage for the elements while they fit inside the array, which takes no space if the inline capacity is 0
 };
 
 // Addition operator - concatenates two Arrays
-template <typename T>
-DynamicArray<T> operator+(const Array<T>& left, const Array<T>& right)
+template <typename T, typename LeftDerived, typename RightDerived>
+DynamicArray<T> operator+(const ArrayBase<T, LeftDerived>& left, const ArrayBase<T, RightDerived>& right)
 {
 	return DynamicArray<T>::Concatenate(left.Data(), left.Size(), right.Data(), right.Size());
 }
 
 // Addition operator - concatenates a c-style array and a Dynamic Array
-template <typename T, size_t N>
-DynamicArray<T> operator+(const T(&left)[N], const DynamicArray<T>& right)
+template <typename T, typename Allocator, size_t InlineCapacity, size_t N>
+DynamicArray<T, Allocator, InlineCapacity> operator+(const T(&left)[N], const DynamicArray<T, Allocator, InlineCapacity>& right)
 {
-	return DynamicArray<T>::Concatenate(left, N, right.m_data, right.m_size);
+	return DynamicArray<T, Allocator, InlineCapacity>::Concatenate(left, N, right.m_data, right.m_size, std::allocator_traits<Allocator>::select_on_container_copy_construction(right.m_allocator));
 }
\ No newline at end of file
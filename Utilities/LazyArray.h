@@ -0,0 +1,397 @@
+/*
+ * LazyArray.h
+ *
+ * This custom lazy array is a pipeline of stages (filters, maps and takes) applied to the elements of another array, created by calling Lazy() on the array.
+ * Adding a stage does not process any elements. Instead the stages are fused into a single pass over the elements when the results are counted or collected,
+ * so no intermediate arrays are created. Pipelines made only of maps write their results directly, so arithmetic maps can be vectorized by the compiler.
+ * 
+ * The pipeline refers to the elements of the array, so the array must not be resized or destroyed until the results have been collected.
+ *
+ * DISCLAIMER: This implementation is intended for portfolio/education purposes only.
+ * For production use, it is recommended to use std::ranges::views instead.
+ *
+ *  Copyright Peter Hoghton. All rights reserved.
+ */
+
+#pragma once
+
+#include "Array.h"
+#include "DynamicArray.h"
+
+template <typename T, typename U, typename Chain, LazyStages Stages>
+class LazyArray
+{
+public:
+	// Constructor with the elements to process and the stages to apply to each of them
+	// Note: Map pipelines take a chain that returns the result for an element, and other pipelines take a chain that passes any results for an element to a sink,
+	// returning false once no more elements need to be processed.
+	LazyArray(const T* data, const size_t size, const Chain& chain) : m_data(data), m_size(size), m_chain(chain) {}
+
+	// Collects the results into a new Dynamic Array
+	DynamicArray<U> Collect() const
+	{
+		return Collect(ExecutionPolicy::Sequential);
+	}
+
+	// Collects the results into a new Dynamic Array using the given execution policy
+	DynamicArray<U> Collect(const ExecutionPolicy policy) const
+	{
+		DynamicArray<U> result;
+		CollectInto(policy, result);
+		return result;
+	}
+
+	// Adds the results to the end of the Dynamic Array, and returns the number of results
+	// Note: The capacity of the Dynamic Array is reused, so collecting into the same array repeatedly does not allocate once it is large enough.
+	template<typename Allocator, size_t InlineCapacity>
+	size_t CollectInto(DynamicArray<U, Allocator, InlineCapacity>& destination) const
+	{
+		return CollectInto(ExecutionPolicy::Sequential, destination);
+	}
+
+	// Adds the results to the end of the Dynamic Array using the given execution policy, and returns the number of results
+	// Note: A parallel map writes the results in place, after the Dynamic Array has grown to fit them. Otherwise each thread collects the results of its chunk,
+	// which are then added in order. Pipelines that take a number of filtered results are always run sequentially, as the elements must be processed in order.
+	template<typename Allocator, size_t InlineCapacity>
+	size_t CollectInto(const ExecutionPolicy policy, DynamicArray<U, Allocator, InlineCapacity>& destination) const
+	{
+		const size_t offset = destination.Size();
+		if constexpr (Stages == LazyStages::Map)
+		{
+			if (m_size == 0)
+			{
+				return 0;
+			}
+
+			if (policy == ExecutionPolicy::Sequential)
+			{
+				// The results are mapped in blocks that stay in the cache before being added, after growing the array to fit all of them at once
+				if (destination.Capacity() < offset + m_size)
+				{
+					destination.Resize(offset + m_size);
+				}
+				if constexpr (s_blockable)
+				{
+					U block[s_blockSize];
+					for (size_t from = 0; from < m_size; from += s_blockSize)
+					{
+						const size_t count = (s_blockSize < m_size - from) ? s_blockSize : m_size - from;
+						MapInto(block, from, from + count);
+						destination.Add(block, count);
+					}
+				}
+				else
+				{
+					for (size_t i = 0; i < m_size; ++i)
+					{
+						destination.Add(m_chain(m_data[i]));
+					}
+				}
+			}
+			else
+			{
+				destination.Fill(policy, U{}, offset, offset + m_size);
+				U* const output = destination.Data() + offset;
+				Base::ParallelFor(policy, 0, m_size, false, [&](const size_t chunkFrom, const size_t chunkTo)
+				{
+					MapInto(output + chunkFrom, chunkFrom, chunkTo);
+					return true;
+				});
+			}
+			return m_size;
+		}
+		else
+		{
+			if (policy == ExecutionPolicy::Sequential || Stages == LazyStages::Take)
+			{
+				AddTo(destination, 0, m_size);
+			}
+			else
+			{
+				for (const DynamicArray<U>& chunk : CollectChunks(policy))
+				{
+					destination.Add(chunk.Data(), chunk.Size());
+				}
+			}
+			return destination.Size() - offset;
+		}
+	}
+
+	// Writes the results to the start of the other Array (e.g. a Static Array or Array View), and returns the number of results
+	// Note: The other Array must be large enough for all of the results, and any elements after them are left unchanged.
+	template<typename Derived>
+	size_t CollectInto(ArrayBase<U, Derived>& destination) const
+	{
+		return CollectInto(ExecutionPolicy::Sequential, destination);
+	}
+
+	// Writes the results to the start of the other Array using the given execution policy, and returns the number of results
+	// Note: The other Array must be large enough for all of the results, and any elements after them are left unchanged.
+	template<typename Derived>
+	size_t CollectInto(const ExecutionPolicy policy, ArrayBase<U, Derived>& destination) const
+	{
+		U* const output = destination.Data();
+		const size_t capacity = destination.Size();
+		if constexpr (Stages == LazyStages::Map)
+		{
+			if (capacity < m_size)
+			{
+				throw std::length_error("Destination array cannot be smaller than the results");
+			}
+
+			Base::ParallelFor(policy, 0, m_size, false, [&](const size_t chunkFrom, const size_t chunkTo)
+			{
+				MapInto(output + chunkFrom, chunkFrom, chunkTo);
+				return true;
+			});
+			return m_size;
+		}
+		else
+		{
+			size_t count = 0;
+			if (policy == ExecutionPolicy::Sequential || Stages == LazyStages::Take)
+			{
+				Run(0, m_size, [&](const U& value)
+				{
+					if (count == capacity)
+					{
+						throw std::length_error("Destination array cannot be smaller than the results");
+					}
+					output[count++] = value;
+					return true;
+				});
+			}
+			else
+			{
+				for (const DynamicArray<U>& chunk : CollectChunks(policy))
+				{
+					if (capacity - count < chunk.Size())
+					{
+						throw std::length_error("Destination array cannot be smaller than the results");
+					}
+					destination.Copy(chunk.Data(), chunk.Size(), count);
+					count += chunk.Size();
+				}
+			}
+			return count;
+		}
+	}
+
+	// Returns the number of results
+	// Note: A pipeline made only of maps always has one result per element, so the maps are not run.
+	size_t Count() const
+	{
+		return Count(ExecutionPolicy::Sequential);
+	}
+
+	// Returns the number of results using the given execution policy
+	// Note: A pipeline made only of maps always has one result per element, so the maps are not run.
+	size_t Count(const ExecutionPolicy policy) const
+	{
+		if constexpr (Stages == LazyStages::Map)
+		{
+			return m_size;
+		}
+		else if constexpr (Stages == LazyStages::Take)
+		{
+			size_t count = 0;
+			Run(0, m_size, [&](const U&) { ++count; return true; });
+			return count;
+		}
+		else
+		{
+			std::atomic<size_t> count = 0;
+			Base::ParallelFor(policy, 0, m_size, false, [&](const size_t chunkFrom, const size_t chunkTo)
+			{
+				size_t chunkCount = 0;
+				Run(chunkFrom, chunkTo, [&](const U&) { ++chunkCount; return true; });
+				count.fetch_add(chunkCount, std::memory_order_relaxed);
+				return true;
+			});
+			return count.load();
+		}
+	}
+
+	// Adds a stage that only keeps the results that satisfy the predicate
+	template<typename Predicate>
+	auto Filter(const Predicate& predicate) const
+	{
+		if constexpr (Stages == LazyStages::Map)
+		{
+			auto chain = [map = m_chain, predicate](const T& element, auto& sink)
+			{
+				decltype(auto) value = map(element);
+				return predicate(value) ? sink(value) : true;
+			};
+			return LazyArray<T, U, decltype(chain), LazyStages::Filter>(m_data, m_size, chain);
+		}
+		else
+		{
+			auto chain = [previous = m_chain, predicate](const T& element, auto& sink) mutable
+			{
+				auto filter = [&](const U& value) { return predicate(value) ? sink(value) : true; };
+				return previous(element, filter);
+			};
+			return LazyArray<T, U, decltype(chain), Stages>(m_data, m_size, chain);
+		}
+	}
+
+	// Calls the function with each result
+	template<typename Function>
+	void ForEach(const Function& function) const
+	{
+		Run(0, m_size, [&](const U& value) { function(value); return true; });
+	}
+
+	// Adds a stage that replaces each result with the result of the function
+	template<typename Function>
+	auto Map(const Function& function) const
+	{
+		using V = std::decay_t<std::invoke_result_t<const Function&, const U&>>;
+		if constexpr (Stages == LazyStages::Map)
+		{
+			auto chain = [map = m_chain, function](const T& element) -> V
+			{
+				return function(map(element));
+			};
+			return LazyArray<T, V, decltype(chain), LazyStages::Map>(m_data, m_size, chain);
+		}
+		else
+		{
+			auto chain = [previous = m_chain, function](const T& element, auto& sink) mutable
+			{
+				auto map = [&](const U& value) { return sink(static_cast<V>(function(value))); };
+				return previous(element, map);
+			};
+			return LazyArray<T, V, decltype(chain), Stages>(m_data, m_size, chain);
+		}
+	}
+
+	// Adds a stage that stops after the given number of results
+	// Note: A pipeline made only of maps simply processes fewer elements, whereas a take after a filter makes the pipeline run sequentially.
+	auto Take(const size_t count) const
+	{
+		if constexpr (Stages == LazyStages::Map)
+		{
+			return LazyArray(m_data, (count < m_size) ? count : m_size, m_chain);
+		}
+		else
+		{
+			auto chain = [previous = m_chain, count, taken = size_t{ 0 }](const T& element, auto& sink) mutable
+			{
+				if (taken >= count)
+				{
+					return false;
+				}
+				auto take = [&](const U& value)
+				{
+					++taken;
+					return sink(value) && taken < count;
+				};
+				return previous(element, take);
+			};
+			return LazyArray<T, U, decltype(chain), LazyStages::Take>(m_data, m_size, chain);
+		}
+	}
+
+private:
+	using Base = ArrayBase<T, Array<T>>; // Provides the parallel helper methods of arrays
+
+	// Adds the results of the elements within the range to the end of the Dynamic Array
+	// Note: Trivially copyable results are gathered in blocks that stay in the cache, so that the Dynamic Array only grows once per block.
+	template<typename Allocator, size_t InlineCapacity>
+	void AddTo(DynamicArray<U, Allocator, InlineCapacity>& destination, const size_t from, const size_t to) const
+	{
+		if constexpr (s_blockable)
+		{
+			U block[s_blockSize];
+			size_t count = 0;
+			Run(from, to, [&](const U& value)
+			{
+				block[count++] = value;
+				if (count == s_blockSize)
+				{
+					destination.Add(block, count);
+					count = 0;
+				}
+				return true;
+			});
+			destination.Add(block, count);
+		}
+		else
+		{
+			Run(from, to, [&](const U& value) { destination.Add(value); return true; });
+		}
+	}
+
+	// Collects the results of each chunk of the elements on worker threads, and returns them in order
+	std::vector<DynamicArray<U>> CollectChunks(const ExecutionPolicy policy) const
+	{
+		std::vector<std::pair<size_t, DynamicArray<U>>> chunks;
+		std::mutex mutex;
+		Base::ParallelFor(policy, 0, m_size, false, [&](const size_t chunkFrom, const size_t chunkTo)
+		{
+			DynamicArray<U> chunk;
+			AddTo(chunk, chunkFrom, chunkTo);
+			std::lock_guard<std::mutex> lock(mutex);
+			chunks.emplace_back(chunkFrom, std::move(chunk));
+			return true;
+		});
+
+		std::sort(chunks.begin(), chunks.end(), [](const auto& left, const auto& right) { return left.first < right.first; });
+		std::vector<DynamicArray<U>> result;
+		result.reserve(chunks.size());
+		for (auto& chunk : chunks)
+		{
+			result.push_back(std::move(chunk.second));
+		}
+		return result;
+	}
+
+	// Writes the results of the elements within the range of a map pipeline to the output
+	// Note: The loop has no branches, so arithmetic maps can be vectorized by the compiler.
+	void MapInto(U* output, const size_t from, const size_t to) const
+	{
+		const T* const data = m_data;
+		const Chain& chain = m_chain;
+		for (size_t i = from; i < to; ++i)
+		{
+			output[i - from] = chain(data[i]);
+		}
+	}
+
+	// Passes the results of the elements within the range to the sink, until the sink or the stages stop the pipeline
+	// Note: The chain is copied, so that any state (e.g. the number of results taken so far) starts afresh each time the pipeline is run.
+	template<typename Sink>
+	void Run(const size_t from, const size_t to, Sink sink) const
+	{
+		if constexpr (Stages == LazyStages::Map)
+		{
+			for (size_t i = from; i < to; ++i)
+			{
+				if (!sink(m_chain(m_data[i])))
+				{
+					return;
+				}
+			}
+		}
+		else
+		{
+			Chain chain = m_chain;
+			for (size_t i = from; i < to; ++i)
+			{
+				if (!chain(m_data[i], sink))
+				{
+					return;
+				}
+			}
+		}
+	}
+
+	static constexpr bool s_blockable = std::is_trivially_copyable_v<U> && std::is_default_constructible_v<U>; // Whether results can be gathered in blocks before being added to a Dynamic Array
+	static constexpr size_t s_blockSize = (sizeof(U) < 4096) ? 4096 / sizeof(U) : 1; // The number of results gathered in each block (4 KB)
+
+	const T* m_data; // Pointer to the first element to process
+	size_t m_size; // Number of elements to process
+	Chain m_chain; // The stages applied to each element
+};
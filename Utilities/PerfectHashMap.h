@@ -0,0 +1,366 @@
+/*
+ * PerfectHashMap.h
+ *
+ * Perfect Hash Sets and Maps are read only hash tables over a fixed set of keys, built from a Static Array of keys (and values) in a constant expression.
+ * Their hash is a minimal perfect hash: each of the N keys has its own slot in a table of exactly N slots, so a lookup hashes the key once,
+ * reads one displacement and compares against a single key, with no probing, no branches on the table contents, and no construction at runtime.
+ *
+ * The table is built using the hash and displace algorithm. The keys are hashed into N buckets, and the buckets are placed largest first,
+ * searching for a displacement that rehashes all of a bucket's keys into free slots. Buckets of a single key are placed straight into a free slot.
+ * Note: The table only depends on the set of keys, not their order, so tables with the same keys are equal, and tables can be composed from smaller ones by concatenation.
+ *
+ * DISCLAIMER: This implementation is intended for portfolio/education purposes only.
+ * For production use, it is recommended to use a perfect hash generator such as gperf instead.
+ *
+ *  Copyright Peter Hoghton. All rights reserved.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+
+#include "StaticArray.h"
+
+// Hashes the keys of Perfect Hash Sets and Maps in constant expressions
+// Note: std::hash is not constexpr, so strings, integers and enums are hashed here. It can be specialized for other key types.
+template<typename Key>
+struct PerfectHasher
+{
+	// Returns the hash of the key - strings are hashed with FNV-1a, while integers and enums are their own hash as the table mixes the bits
+	constexpr uint64_t operator()(const Key& key) const
+	{
+		if constexpr (std::is_convertible_v<const Key&, std::string_view>)
+		{
+			uint64_t hash = s_fnvOffsetBasis;
+			for (const char character : std::string_view(key))
+			{
+				hash = (hash ^ static_cast<unsigned char>(character)) * s_fnvPrime;
+			}
+			return hash;
+		}
+		else
+		{
+			static_assert(std::is_integral_v<Key> || std::is_enum_v<Key>, "Perfect Hasher must be specialized for this key type");
+			return static_cast<uint64_t>(key);
+		}
+	}
+
+	static constexpr uint64_t s_fnvOffsetBasis = 0xCBF29CE484222325; // The initial FNV-1a hash
+	static constexpr uint64_t s_fnvPrime = 0x100000001B3; // The FNV-1a prime multiplied into the hash for each character
+};
+
+template<typename Key, size_t N, typename Hasher = PerfectHasher<Key>>
+class PerfectHashSet final
+{
+	static_assert(N > 0, "Perfect Hash Set must have at least 1 key");
+	static_assert(N <= static_cast<size_t>(std::numeric_limits<int32_t>::max()), "Perfect Hash Set slots must fit in a displacement");
+
+public:
+	// Conversion constructor from Static Array - builds the table for the keys
+	// Note: Throws std::invalid_argument if the keys aren't unique, which is a compile error when constant evaluated.
+	constexpr PerfectHashSet(const StaticArray<Key, N>& keys)
+	{
+		// Groups the indices of the keys by bucket, using a counting sort
+		StaticArray<uint64_t, N> hashes{};
+		StaticArray<size_t, N + 1> bucketStarts{};
+		for (size_t i = 0; i < N; ++i)
+		{
+			hashes[i] = Mix(Hasher{}(keys[i]));
+			++bucketStarts[static_cast<size_t>(hashes[i] % N) + 1];
+		}
+		for (size_t i = 1; i <= N; ++i)
+		{
+			bucketStarts[i] += bucketStarts[i - 1];
+		}
+
+		StaticArray<size_t, N> bucketKeys{};
+		StaticArray<size_t, N + 1> bucketEnds = bucketStarts;
+		for (size_t i = 0; i < N; ++i)
+		{
+			bucketKeys[bucketEnds[static_cast<size_t>(hashes[i] % N)]++] = i;
+		}
+
+		// Places the largest buckets first, while the table is emptiest
+		// Note: Equal sized buckets are placed in order so that the table only depends on the set of keys.
+		StaticArray<size_t, N> buckets{};
+		for (size_t i = 0; i < N; ++i)
+		{
+			buckets[i] = i;
+		}
+		buckets.Sort([&](const size_t left, const size_t right)
+		{
+			const size_t leftSize = bucketStarts[left + 1] - bucketStarts[left];
+			const size_t rightSize = bucketStarts[right + 1] - bucketStarts[right];
+			return leftSize > rightSize || (leftSize == rightSize && left < right);
+		});
+
+		StaticArray<bool, N> occupied{};
+		StaticArray<size_t, N> slots{};
+		size_t freeSlot = 0;
+
+		for (const size_t bucket : buckets)
+		{
+			const size_t* bucketKey = bucketKeys.Data() + bucketStarts[bucket];
+			const size_t bucketSize = bucketStarts[bucket + 1] - bucketStarts[bucket];
+
+			if (bucketSize == 0)
+			{
+				break; // The remaining buckets are empty
+			}
+
+			if (bucketSize == 1)
+			{
+				while (occupied[freeSlot])
+				{
+					++freeSlot;
+				}
+				occupied[freeSlot] = true;
+				m_keys[freeSlot] = keys[bucketKey[0]];
+				m_displacements[bucket] = ~static_cast<int32_t>(freeSlot);
+				continue;
+			}
+
+			// Keys with equal hashes can never be displaced into different slots
+			for (size_t i = 1; i < bucketSize; ++i)
+			{
+				for (size_t j = 0; j < i; ++j)
+				{
+					if (hashes[bucketKey[i]] == hashes[bucketKey[j]])
+					{
+						throw std::invalid_argument(Equal(keys[bucketKey[i]], keys[bucketKey[j]]) ? "Perfect Hash keys must be unique" : "Perfect Hash keys have colliding hashes");
+					}
+				}
+			}
+
+			for (int32_t displacement = 1;; ++displacement)
+			{
+				size_t placed = 0;
+				for (; placed < bucketSize; ++placed)
+				{
+					slots[placed] = Displace(hashes[bucketKey[placed]], displacement);
+					if (occupied[slots[placed]] || (placed > 0 && slots.Contains(slots[placed], 0, placed)))
+					{
+						break;
+					}
+				}
+
+				if (placed == bucketSize)
+				{
+					for (size_t i = 0; i < bucketSize; ++i)
+					{
+						occupied[slots[i]] = true;
+						m_keys[slots[i]] = keys[bucketKey[i]];
+					}
+					m_displacements[bucket] = displacement;
+					break;
+				}
+			}
+		}
+	}
+
+	// Equality operator - compares the keys of the sets, regardless of the order they were given in
+	template<size_t M>
+	constexpr bool operator==(const PerfectHashSet<Key, M, Hasher>& other) const
+	{
+		if constexpr (M != N)
+		{
+			return false;
+		}
+		else
+		{
+			for (size_t i = 0; i < N; ++i)
+			{
+				if (!Equal(m_keys[i], other.Keys()[i]))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+	}
+
+	// Inequality operator
+	template<size_t M>
+	constexpr bool operator!=(const PerfectHashSet<Key, M, Hasher>& other) const
+	{
+		return !(*this == other);
+	}
+
+	// Addition operator - builds the set of the keys of both sets
+	template<size_t M>
+	constexpr PerfectHashSet<Key, N + M, Hasher> operator+(const PerfectHashSet<Key, M, Hasher>& other) const
+	{
+		return PerfectHashSet<Key, N + M, Hasher>(m_keys + other.Keys());
+	}
+
+	// Addition operator - builds the set of the keys of the set and the Static Array
+	template<size_t M>
+	constexpr PerfectHashSet<Key, N + M, Hasher> operator+(const StaticArray<Key, M>& other) const
+	{
+		return PerfectHashSet<Key, N + M, Hasher>(m_keys + other);
+	}
+
+	// Returns true if the set contains the key
+	constexpr bool Contains(const Key& key) const
+	{
+		return IndexOf(key) != N;
+	}
+
+	// Returns the index of the key in Keys(), or the size of the set if it isn't found
+	// Note: The key's slot is found without branching, then compared against the one key that can be there.
+	constexpr size_t IndexOf(const Key& key) const
+	{
+		const size_t slot = Slot(Mix(Hasher{}(key)));
+		return Equal(m_keys.Unchecked(slot), key) ? slot : N;
+	}
+
+	// Returns the keys of the set, in slot order
+	constexpr const StaticArray<Key, N>& Keys() const
+	{
+		return m_keys;
+	}
+
+	// Returns the number of keys in the set
+	constexpr size_t Size() const
+	{
+		return N;
+	}
+
+private:
+	// Returns the slot of the hash when rehashed with the displacement
+	static constexpr size_t Displace(const uint64_t hash, const int32_t displacement)
+	{
+		return static_cast<size_t>(Mix(hash + static_cast<uint64_t>(displacement) * s_hashMultiplier) % N);
+	}
+
+	// Returns whether the keys are equal
+	// Note: Keys that convert to strings are hashed by their contents, so they are compared by their contents too (rather than as pointers for const char*).
+	static constexpr bool Equal(const Key& left, const Key& right)
+	{
+		if constexpr (std::is_convertible_v<const Key&, std::string_view>)
+		{
+			return std::string_view(left) == std::string_view(right);
+		}
+		else
+		{
+			return left == right;
+		}
+	}
+
+	// Mixes the bits of the hash, so that the bucket and slots depend on all of them
+	// Note: This is the SplitMix64 finalizer, which is a bijection, so distinct integer keys always have distinct hashes.
+	static constexpr uint64_t Mix(uint64_t hash)
+	{
+		hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9;
+		hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EB;
+		return hash ^ (hash >> 31);
+	}
+
+	// Returns the slot of the mixed hash
+	// Note: Buckets of a single key store the complement of their slot (which is negative) instead of a displacement.
+	constexpr size_t Slot(const uint64_t hash) const
+	{
+		const int32_t displacement = m_displacements.Unchecked(static_cast<size_t>(hash % N));
+		return displacement < 0 ? static_cast<size_t>(~displacement) : Displace(hash, displacement);
+	}
+
+	StaticArray<Key, N> m_keys{}; // The keys, in slot order
+	StaticArray<int32_t, N> m_displacements{}; // The displacement of each bucket, or the complement of the slot of a single key bucket
+
+	static constexpr uint64_t s_hashMultiplier = 0x9E3779B97F4A7C15; // 2^64 divided by the golden ratio, used to spread displacements across the hashes
+};
+
+template<typename Key, typename Value, size_t N, typename Hasher = PerfectHasher<Key>>
+class PerfectHashMap final
+{
+public:
+	// Conversion constructor from Static Arrays - builds the table for the keys and stores each value in its key's slot
+	// Note: Throws std::invalid_argument if the keys aren't unique, which is a compile error when constant evaluated.
+	constexpr PerfectHashMap(const StaticArray<Key, N>& keys, const StaticArray<Value, N>& values) : m_set(keys)
+	{
+		for (size_t i = 0; i < N; ++i)
+		{
+			m_values[m_set.IndexOf(keys[i])] = values[i];
+		}
+	}
+
+	// Equality operator - compares the keys and values of the maps, regardless of the order they were given in
+	template<size_t M>
+	constexpr bool operator==(const PerfectHashMap<Key, Value, M, Hasher>& other) const
+	{
+		return m_set == other.m_set && m_values == other.Values();
+	}
+
+	// Inequality operator
+	template<size_t M>
+	constexpr bool operator!=(const PerfectHashMap<Key, Value, M, Hasher>& other) const
+	{
+		return !(*this == other);
+	}
+
+	// Addition operator - builds the map of the keys and values of both maps
+	template<size_t M>
+	constexpr PerfectHashMap<Key, Value, N + M, Hasher> operator+(const PerfectHashMap<Key, Value, M, Hasher>& other) const
+	{
+		return PerfectHashMap<Key, Value, N + M, Hasher>(Keys() + other.Keys(), m_values + other.Values());
+	}
+
+	// Returns the value of the key
+	// Note: Throws std::out_of_range if the key isn't found.
+	constexpr const Value& At(const Key& key) const
+	{
+		const size_t index = m_set.IndexOf(key);
+		if (index == N)
+		{
+			throw std::out_of_range("Perfect Hash Map key not found");
+		}
+		return m_values.Unchecked(index);
+	}
+
+	// Returns true if the map contains the key
+	constexpr bool Contains(const Key& key) const
+	{
+		return m_set.Contains(key);
+	}
+
+	// Returns a pointer to the value of the key, or nullptr if it isn't found
+	constexpr const Value* Find(const Key& key) const
+	{
+		const size_t index = m_set.IndexOf(key);
+		return index != N ? m_values.Data() + index : nullptr;
+	}
+
+	// Returns the index of the key in Keys() and Values(), or the size of the map if it isn't found
+	constexpr size_t IndexOf(const Key& key) const
+	{
+		return m_set.IndexOf(key);
+	}
+
+	// Returns the keys of the map, in slot order
+	constexpr const StaticArray<Key, N>& Keys() const
+	{
+		return m_set.Keys();
+	}
+
+	// Returns the number of keys in the map
+	constexpr size_t Size() const
+	{
+		return N;
+	}
+
+	// Returns the values of the map, in the same order as the keys
+	constexpr const StaticArray<Value, N>& Values() const
+	{
+		return m_values;
+	}
+
+private:
+	template<typename, typename, size_t, typename>
+	friend class PerfectHashMap;
+
+	PerfectHashSet<Key, N, Hasher> m_set; // The keys and their hash table
+	StaticArray<Value, N> m_values{}; // The values, in the same slots as their keys
+};
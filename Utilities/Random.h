@@ -0,0 +1,173 @@
+/*
+ * Random.h
+ *
+ * A fast seedable pseudo-random number generator (xoshiro256**) for use by the array data structures, e.g. to shuffle them.
+ *
+ * It satisfies the standard uniform random bit generator requirements, so it can also be used with the distributions in <random>.
+ * Bounded random integers are generated using Lemire's nearly divisionless method, which is unbiased unlike taking the remainder.
+ *
+ * DISCLAIMER: This implementation is intended for portfolio/education purposes only.
+ * For production use, it is recommended to use the engines in <random> instead.
+ *
+ *  Copyright Peter Hoghton. All rights reserved.
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+class Random
+{
+public:
+	using result_type = uint64_t;
+
+	// Returns the smallest number the generator can produce
+	static constexpr result_type min()
+	{
+		return 0;
+	}
+
+	// Returns the largest number the generator can produce
+	static constexpr result_type max()
+	{
+		return std::numeric_limits<result_type>::max();
+	}
+
+	// Default constructor - seeds the generator from std::random_device, so each instance produces a different sequence
+	Random() : Random((static_cast<uint64_t>(std::random_device{}()) << 32) ^ std::random_device{}()) {}
+
+	// Constructor with seed argument - the same seed always produces the same sequence
+	explicit Random(const uint64_t seed)
+	{
+		Seed(seed);
+	}
+
+	// Returns the next random number
+	result_type operator()()
+	{
+		const uint64_t result = std::rotl(m_state[1] * 5, 7) * 9;
+		const uint64_t shifted = m_state[1] << 17;
+
+		m_state[2] ^= m_state[0];
+		m_state[3] ^= m_state[1];
+		m_state[1] ^= m_state[2];
+		m_state[0] ^= m_state[3];
+		m_state[2] ^= shifted;
+		m_state[3] = std::rotl(m_state[3], 45);
+
+		return result;
+	}
+
+	// Returns a uniformly distributed random number in the range [0, bound)
+	// Note: The bound must not be zero.
+	uint64_t Bounded(const uint64_t bound)
+	{
+		return Bounded(*this, bound);
+	}
+
+	// Returns a uniformly distributed random number in the range [0, bound) using the given engine
+	// Note: The bound must not be zero. Engines that produce full 64-bit numbers use Lemire's method, which needs a division only when a number has to be rejected.
+	template<std::uniform_random_bit_generator Engine>
+	static uint64_t Bounded(Engine& engine, const uint64_t bound)
+	{
+		if constexpr (Engine::min() == 0 && Engine::max() == std::numeric_limits<uint64_t>::max())
+		{
+			// The high half of the 128-bit product is the result, and the low half is only used to reject the few numbers that would bias it
+			uint64_t low;
+			uint64_t high = MultiplyHigh(engine(), bound, low);
+			if (low < bound)
+			{
+				const uint64_t threshold = (0 - bound) % bound;
+				while (low < threshold)
+				{
+					high = MultiplyHigh(engine(), bound, low);
+				}
+			}
+			return high;
+		}
+		else
+		{
+			return std::uniform_int_distribution<uint64_t>(0, bound - 1)(engine);
+		}
+	}
+
+	// Advances the generator as if it had been called 2^128 times
+	// Note: This can be used to create generators whose sequences do not overlap, e.g. one for each thread.
+	void Jump()
+	{
+		static constexpr uint64_t s_jump[] = { 0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c };
+
+		uint64_t state[4] = {};
+		for (const uint64_t jump : s_jump)
+		{
+			for (size_t bit = 0; bit < 64; ++bit)
+			{
+				if (jump & (uint64_t{ 1 } << bit))
+				{
+					for (size_t i = 0; i < 4; ++i)
+					{
+						state[i] ^= m_state[i];
+					}
+				}
+				(*this)();
+			}
+		}
+		for (size_t i = 0; i < 4; ++i)
+		{
+			m_state[i] = state[i];
+		}
+	}
+
+	// Reseeds the generator
+	// Note: The state is filled using a SplitMix64 generator, so similar seeds still produce unrelated sequences.
+	void Seed(uint64_t seed)
+	{
+		for (uint64_t& state : m_state)
+		{
+			seed += 0x9e3779b97f4a7c15;
+			uint64_t z = seed;
+			z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+			z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+			state = z ^ (z >> 31);
+		}
+	}
+
+private:
+	// Returns the high half of the 128-bit product of the two numbers, and sets the low half
+	static uint64_t MultiplyHigh(const uint64_t left, const uint64_t right, uint64_t& low)
+	{
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+		uint64_t high;
+		low = _umul128(left, right, &high);
+		return high;
+#elif defined(_MSC_VER) && !defined(__clang__) && defined(_M_ARM64)
+		low = left * right;
+		return __umulh(left, right);
+#elif defined(__SIZEOF_INT128__)
+		const unsigned __int128 product = static_cast<unsigned __int128>(left) * right;
+		low = static_cast<uint64_t>(product);
+		return static_cast<uint64_t>(product >> 64);
+#else
+		// Multiplies the 32-bit halves separately and adds up the partial products
+		const uint64_t leftLow = left & 0xffffffff;
+		const uint64_t leftHigh = left >> 32;
+		const uint64_t rightLow = right & 0xffffffff;
+		const uint64_t rightHigh = right >> 32;
+		const uint64_t lowLow = leftLow * rightLow;
+		const uint64_t highLow = leftHigh * rightLow;
+		const uint64_t lowHigh = leftLow * rightHigh;
+		const uint64_t middle = (lowLow >> 32) + (highLow & 0xffffffff) + lowHigh;
+		low = left * right;
+		return leftHigh * rightHigh + (highLow >> 32) + (middle >> 32);
+#endif
+	}
+
+	uint64_t m_state[4];
+};
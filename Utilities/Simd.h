@@ -0,0 +1,584 @@
+/*
+ * Simd.h
+ *
+ * Vectorized kernels used by the array data structures to speed up common operations on arithmetic element types.
+ *
+ * The widest instruction set enabled at compile time is used (AVX-512, AVX2 or SSE2), e.g. /arch:AVX2 or /arch:AVX512 with MSVC, or -mavx2 or -mavx512bw with GCC/Clang.
+ * A scalar implementation is used when no supported instruction set is available.
+ *
+ * DISCLAIMER: This implementation is intended for portfolio/education purposes only.
+ *
+ *  Copyright Peter Hoghton. All rights reserved.
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+#define SIMD_AVX512
+#elif defined(__AVX2__)
+#define SIMD_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SIMD_SSE2
+#endif
+
+#if defined(SIMD_AVX512) || defined(SIMD_AVX2) || defined(SIMD_SSE2)
+#include <immintrin.h>
+#endif
+
+namespace Simd
+{
+	// Element types supported by the vectorized kernels
+	template<typename T>
+	concept Arithmetic = (std::is_integral_v<T> && !std::is_same_v<T, bool>) || std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+	namespace Detail
+	{
+#if defined(SIMD_AVX512)
+		using Register = __m512i;
+		using Mask = uint64_t;
+		constexpr size_t s_maskBitsPerByte = 0; // Comparison masks have one bit per element
+
+		inline Register Load(const void* data)
+		{
+			return _mm512_loadu_si512(data);
+		}
+
+		inline void Store(void* data, const Register value)
+		{
+			_mm512_storeu_si512(data, value);
+		}
+
+		// Note: The data must be aligned to the register size.
+		inline void Stream(void* data, const Register value)
+		{
+			_mm512_stream_si512(static_cast<__m512i*>(data), value);
+		}
+
+		template<typename T>
+		Mask Equal(const Register left, const Register right)
+		{
+			if constexpr (std::is_same_v<T, float>)
+			{
+				return _mm512_cmp_ps_mask(_mm512_castsi512_ps(left), _mm512_castsi512_ps(right), _CMP_EQ_OQ);
+			}
+			else if constexpr (std::is_same_v<T, double>)
+			{
+				return _mm512_cmp_pd_mask(_mm512_castsi512_pd(left), _mm512_castsi512_pd(right), _CMP_EQ_OQ);
+			}
+			else if constexpr (sizeof(T) == 1)
+			{
+				return _mm512_cmpeq_epi8_mask(left, right);
+			}
+			else if constexpr (sizeof(T) == 2)
+			{
+				return _mm512_cmpeq_epi16_mask(left, right);
+			}
+			else if constexpr (sizeof(T) == 4)
+			{
+				return _mm512_cmpeq_epi32_mask(left, right);
+			}
+			else
+			{
+				return _mm512_cmpeq_epi64_mask(left, right);
+			}
+		}
+
+		// Whether CompressUnequal supports the element type (AVX-512F can only compress 32-bit and 64-bit elements)
+		template<typename T>
+		constexpr bool s_compressible = sizeof(T) >= 4;
+
+		// Moves the elements that are not equal to the front of the register, and sets the count to the number of them
+		template<typename T>
+		Register CompressUnequal(const Register values, const Register target, size_t& count)
+		{
+			constexpr Mask lanes = (Mask{ 1 } << (sizeof(Register) / sizeof(T))) - 1;
+			const Mask keep = ~Equal<T>(values, target) & lanes;
+			count = std::popcount(keep);
+			if constexpr (sizeof(T) == 4)
+			{
+				return _mm512_maskz_compress_epi32(static_cast<__mmask16>(keep), values);
+			}
+			else
+			{
+				return _mm512_maskz_compress_epi64(static_cast<__mmask8>(keep), values);
+			}
+		}
+#elif defined(SIMD_AVX2)
+		using Register = __m256i;
+		using Mask = uint32_t;
+		constexpr size_t s_maskBitsPerByte = 1; // Comparison masks have one bit per byte
+
+		inline Register Load(const void* data)
+		{
+			return _mm256_loadu_si256(static_cast<const __m256i*>(data));
+		}
+
+		inline void Store(void* data, const Register value)
+		{
+			_mm256_storeu_si256(static_cast<__m256i*>(data), value);
+		}
+
+		// Note: The data must be aligned to the register size.
+		inline void Stream(void* data, const Register value)
+		{
+			_mm256_stream_si256(static_cast<__m256i*>(data), value);
+		}
+
+		// Returns a register with every byte of each equal element set
+		template<typename T>
+		Register Compare(const Register left, const Register right)
+		{
+			if constexpr (std::is_same_v<T, float>)
+			{
+				return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(left), _mm256_castsi256_ps(right), _CMP_EQ_OQ));
+			}
+			else if constexpr (std::is_same_v<T, double>)
+			{
+				return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(left), _mm256_castsi256_pd(right), _CMP_EQ_OQ));
+			}
+			else if constexpr (sizeof(T) == 1)
+			{
+				return _mm256_cmpeq_epi8(left, right);
+			}
+			else if constexpr (sizeof(T) == 2)
+			{
+				return _mm256_cmpeq_epi16(left, right);
+			}
+			else if constexpr (sizeof(T) == 4)
+			{
+				return _mm256_cmpeq_epi32(left, right);
+			}
+			else
+			{
+				return _mm256_cmpeq_epi64(left, right);
+			}
+		}
+
+		// Returns a mask with one bit set for each byte of each equal element
+		template<typename T>
+		Mask Equal(const Register left, const Register right)
+		{
+			return static_cast<Mask>(_mm256_movemask_epi8(Compare<T>(left, right)));
+		}
+
+		// Returns a register with every byte set to zero
+		inline Register Zero()
+		{
+			return _mm256_setzero_si256();
+		}
+
+		// Subtracts each byte of the right register from the left register
+		inline Register SubtractBytes(const Register left, const Register right)
+		{
+			return _mm256_sub_epi8(left, right);
+		}
+
+		// Returns the sum of every byte in the register
+		inline size_t SumBytes(const Register value)
+		{
+			uint64_t sums[4];
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(sums), _mm256_sad_epu8(value, _mm256_setzero_si256()));
+			return static_cast<size_t>(sums[0] + sums[1] + sums[2] + sums[3]);
+		}
+
+		// Whether CompressUnequal supports the element type (AVX2 can only permute 32-bit lanes across the register)
+		template<typename T>
+		constexpr bool s_compressible = sizeof(T) >= 4;
+
+		// The 32-bit lane permutations that move the elements not selected by each mask to the front of the register
+		template<typename T>
+		constexpr auto s_compressPermutations = []
+		{
+			constexpr size_t lanes = sizeof(Register) / sizeof(T);
+			constexpr size_t parts = sizeof(T) / 4;
+			std::array<std::array<int32_t, 8>, size_t{ 1 } << lanes> permutations{};
+			for (size_t mask = 0; mask < permutations.size(); ++mask)
+			{
+				size_t count = 0;
+				for (size_t lane = 0; lane < lanes; ++lane)
+				{
+					for (size_t part = 0; (mask & (size_t{ 1 } << lane)) == 0 && part < parts; ++part)
+					{
+						permutations[mask][count++] = static_cast<int32_t>(lane * parts + part);
+					}
+				}
+			}
+			return permutations;
+		}();
+
+		// Moves the elements that are not equal to the front of the register, and sets the count to the number of them
+		template<typename T>
+		Register CompressUnequal(const Register values, const Register target, size_t& count)
+		{
+			const Register equal = Compare<T>(values, target);
+			const uint32_t mask = (sizeof(T) == 4) ? _mm256_movemask_ps(_mm256_castsi256_ps(equal)) : _mm256_movemask_pd(_mm256_castsi256_pd(equal));
+			count = sizeof(Register) / sizeof(T) - std::popcount(mask);
+			return _mm256_permutevar8x32_epi32(values, Load(s_compressPermutations<T>[mask].data()));
+		}
+#elif defined(SIMD_SSE2)
+		using Register = __m128i;
+		using Mask = uint32_t;
+		constexpr size_t s_maskBitsPerByte = 1; // Comparison masks have one bit per byte
+
+		inline Register Load(const void* data)
+		{
+			return _mm_loadu_si128(static_cast<const __m128i*>(data));
+		}
+
+		inline void Store(void* data, const Register value)
+		{
+			_mm_storeu_si128(static_cast<__m128i*>(data), value);
+		}
+
+		// Note: The data must be aligned to the register size.
+		inline void Stream(void* data, const Register value)
+		{
+			_mm_stream_si128(static_cast<__m128i*>(data), value);
+		}
+
+		// Returns a register with every byte of each equal element set
+		template<typename T>
+		Register Compare(const Register left, const Register right)
+		{
+			if constexpr (std::is_same_v<T, float>)
+			{
+				return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(left), _mm_castsi128_ps(right)));
+			}
+			else if constexpr (std::is_same_v<T, double>)
+			{
+				return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(left), _mm_castsi128_pd(right)));
+			}
+			else if constexpr (sizeof(T) == 1)
+			{
+				return _mm_cmpeq_epi8(left, right);
+			}
+			else if constexpr (sizeof(T) == 2)
+			{
+				return _mm_cmpeq_epi16(left, right);
+			}
+			else if constexpr (sizeof(T) == 4)
+			{
+				return _mm_cmpeq_epi32(left, right);
+			}
+			else
+			{
+				// SSE2 has no 64-bit comparison, so both 32-bit halves must be equal
+				const Register result = _mm_cmpeq_epi32(left, right);
+				return _mm_and_si128(result, _mm_shuffle_epi32(result, _MM_SHUFFLE(2, 3, 0, 1)));
+			}
+		}
+
+		// Returns a mask with one bit set for each byte of each equal element
+		template<typename T>
+		Mask Equal(const Register left, const Register right)
+		{
+			return static_cast<Mask>(_mm_movemask_epi8(Compare<T>(left, right)));
+		}
+
+		// Returns a register with every byte set to zero
+		inline Register Zero()
+		{
+			return _mm_setzero_si128();
+		}
+
+		// Subtracts each byte of the right register from the left register
+		inline Register SubtractBytes(const Register left, const Register right)
+		{
+			return _mm_sub_epi8(left, right);
+		}
+
+		// Returns the sum of every byte in the register
+		inline size_t SumBytes(const Register value)
+		{
+			uint64_t sums[2];
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(sums), _mm_sad_epu8(value, _mm_setzero_si128()));
+			return static_cast<size_t>(sums[0] + sums[1]);
+		}
+
+		// Whether CompressUnequal supports the element type (SSE2 has no variable shuffle, so no types are supported)
+		template<typename T>
+		constexpr bool s_compressible = false;
+#endif
+
+#if defined(SIMD_AVX512) || defined(SIMD_AVX2) || defined(SIMD_SSE2)
+#define SIMD_VECTORIZED
+
+		// Returns a register with every element set to the given value
+		template<typename T>
+		Register Broadcast(const T value)
+		{
+			T values[sizeof(Register) / sizeof(T)];
+			for (T& element : values)
+			{
+				element = value;
+			}
+			return Load(values);
+		}
+
+		// The number of elements in a register
+		template<typename T>
+		constexpr size_t s_lanes = sizeof(Register) / sizeof(T);
+
+		// The number of mask bits for each element
+		template<typename T>
+		constexpr size_t s_maskBits = s_maskBitsPerByte == 0 ? 1 : sizeof(T);
+
+		// The number of mask bits
+		constexpr size_t s_maskSize = sizeof(Mask) * 8;
+
+		// The comparison mask when every element in a register is equal
+		template<typename T>
+		constexpr Mask s_equalMask = (s_lanes<T> * s_maskBits<T> == s_maskSize) ? ~Mask{ 0 } : (Mask{ 1 } << (s_lanes<T> * s_maskBits<T>)) - 1;
+#endif
+	}
+
+	// The size in bytes from which fills use non-temporal stores
+	// Note: Ranges this large would evict most of the cache anyway, so they bypass it instead.
+	constexpr size_t s_nonTemporalThreshold = size_t{ 1 } << 23;
+
+	// Copies the given number of bytes from the source to the destination, which may overlap
+	// Note: The C runtime already uses non-temporal stores for large copies, which measured faster than our own.
+	inline void Copy(void* destination, const void* source, const size_t size)
+	{
+		if (size > 0)
+		{
+			std::memmove(destination, source, size);
+		}
+	}
+
+	// Returns the number of elements equal to the given value
+	template<Arithmetic T>
+	size_t Count(const T* data, const size_t size, const T value)
+	{
+		size_t count = 0;
+		size_t i = 0;
+#if defined(SIMD_VECTORIZED)
+		using namespace Detail;
+		const Register target = Broadcast(value);
+#if defined(SIMD_AVX512)
+		for (; i + s_lanes<T> <= size; i += s_lanes<T>)
+		{
+			count += std::popcount(Equal<T>(Load(data + i), target));
+		}
+#else
+		// Matching bytes are counted in per-byte counters, which are summed before they can overflow
+		while (i + s_lanes<T> <= size)
+		{
+			Register counters = Zero();
+			for (size_t j = 0; j < 255 && i + s_lanes<T> <= size; ++j, i += s_lanes<T>)
+			{
+				counters = SubtractBytes(counters, Compare<T>(Load(data + i), target));
+			}
+			count += SumBytes(counters) / sizeof(T);
+		}
+#endif
+#endif
+		for (; i < size; ++i)
+		{
+			count += (data[i] == value) ? 1 : 0;
+		}
+		return count;
+	}
+
+	// Returns whether the elements of the two raw arrays are equal
+	template<Arithmetic T>
+	bool Equals(const T* left, const T* right, const size_t size)
+	{
+		if constexpr (std::is_integral_v<T>)
+		{
+			// Integers have no padding bits, so equal values have equal bytes
+			return size == 0 || std::memcmp(left, right, size * sizeof(T)) == 0;
+		}
+		else
+		{
+			// Floating point values are compared as values, as NaN is never equal and 0.0 equals -0.0
+			size_t i = 0;
+#if defined(SIMD_VECTORIZED)
+			using namespace Detail;
+			for (; i + s_lanes<T> <= size; i += s_lanes<T>)
+			{
+				if (Equal<T>(Load(left + i), Load(right + i)) != s_equalMask<T>)
+				{
+					return false;
+				}
+			}
+#endif
+			for (; i < size; ++i)
+			{
+				if (left[i] != right[i])
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+	}
+
+	// Sets the given number of elements to the given value
+	template<typename T>
+	requires std::is_trivially_copyable_v<T>
+	void Fill(T* data, const size_t size, const T& value)
+	{
+		if (size == 0)
+		{
+			return;
+		}
+
+		// The value is copied first as it may be an element of the data
+		const T copy = value;
+		unsigned char bytes[sizeof(T)];
+		std::memcpy(bytes, &copy, sizeof(T));
+		bool repeated = true;
+		for (const unsigned char byte : bytes)
+		{
+			repeated = repeated && byte == bytes[0];
+		}
+		if (repeated)
+		{
+			std::memset(static_cast<void*>(data), bytes[0], size * sizeof(T));
+			return;
+		}
+
+		size_t i = 0;
+#if defined(SIMD_VECTORIZED)
+		using namespace Detail;
+		if constexpr (sizeof(Register) % sizeof(T) == 0)
+		{
+			const Register pattern = Broadcast(copy);
+			if (size * sizeof(T) >= s_nonTemporalThreshold && reinterpret_cast<uintptr_t>(data) % sizeof(T) == 0)
+			{
+				// Fills up to the first aligned element normally, as non-temporal stores must be aligned
+				for (; reinterpret_cast<uintptr_t>(data + i) % sizeof(Register) != 0; ++i)
+				{
+					data[i] = copy;
+				}
+				for (; i + s_lanes<T> <= size; i += s_lanes<T>)
+				{
+					Stream(data + i, pattern);
+				}
+				_mm_sfence();
+			}
+			for (; i + s_lanes<T> <= size; i += s_lanes<T>)
+			{
+				Store(data + i, pattern);
+			}
+			for (; i < size; ++i)
+			{
+				data[i] = copy;
+			}
+			return;
+		}
+#endif
+		// Repeatedly doubles the filled prefix, then copies it in blocks small enough to stay in the cache
+		constexpr size_t blockSize = (4096 / sizeof(T) > 0) ? 4096 / sizeof(T) : 1;
+		data[0] = copy;
+		for (i = 1; i < size && i < blockSize; i *= 2)
+		{
+			std::memcpy(data + i, data, ((i < size - i) ? i : size - i) * sizeof(T));
+		}
+		for (; i < size; i += blockSize)
+		{
+			std::memcpy(data + i, data, ((blockSize < size - i) ? blockSize : size - i) * sizeof(T));
+		}
+	}
+
+	// Returns the index of the first element equal to the given value, or the size if not found
+	template<Arithmetic T>
+	size_t IndexOf(const T* data, const size_t size, const T value)
+	{
+		size_t i = 0;
+#if defined(SIMD_VECTORIZED)
+		using namespace Detail;
+		const Register target = Broadcast(value);
+		for (; i + s_lanes<T> <= size; i += s_lanes<T>)
+		{
+			const Mask mask = Equal<T>(Load(data + i), target);
+			if (mask != 0)
+			{
+				return i + std::countr_zero(mask) / s_maskBits<T>;
+			}
+		}
+#endif
+		for (; i < size; ++i)
+		{
+			if (data[i] == value)
+			{
+				return i;
+			}
+		}
+		return size;
+	}
+
+	// Hints that the cache line containing the given address will be read soon
+	inline void Prefetch(const void* address)
+	{
+#if defined(SIMD_VECTORIZED)
+		_mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#endif
+	}
+
+	// Removes the elements equal to the given value by moving the remaining elements forward in order, and returns the number remaining
+	// Note: Only element types that can be compressed within a register are vectorized, as a scalar loop without branches measured faster otherwise.
+	template<Arithmetic T>
+	size_t Remove(T* data, const size_t size, const T value)
+	{
+		size_t index = 0;
+		size_t i = 0;
+#if defined(SIMD_VECTORIZED)
+		using namespace Detail;
+		if constexpr (s_compressible<T>)
+		{
+			const Register target = Broadcast(value);
+			for (; i + s_lanes<T> <= size; i += s_lanes<T>)
+			{
+				// Stores never reach past the register just loaded, as the index can't overtake it
+				size_t count;
+				Store(data + index, CompressUnequal<T>(Load(data + i), target, count));
+				index += count;
+			}
+		}
+#endif
+		for (; i < size; ++i)
+		{
+			const T element = data[i];
+			data[index] = element;
+			index += (element == value) ? 0 : 1;
+		}
+		return index;
+	}
+
+	// Returns the index of the last element equal to the given value, or the size if not found
+	template<Arithmetic T>
+	size_t ReverseIndexOf(const T* data, const size_t size, const T value)
+	{
+		size_t i = size;
+#if defined(SIMD_VECTORIZED)
+		using namespace Detail;
+		const Register target = Broadcast(value);
+		for (; i >= s_lanes<T>; i -= s_lanes<T>)
+		{
+			const Mask mask = Equal<T>(Load(data + i - s_lanes<T>), target);
+			if (mask != 0)
+			{
+				const size_t highestBit = s_maskSize - 1 - std::countl_zero(mask);
+				return i - s_lanes<T> + highestBit / s_maskBits<T>;
+			}
+		}
+#endif
+		for (; i > 0; --i)
+		{
+			if (data[i - 1] == value)
+			{
+				return i - 1;
+			}
+		}
+		return size;
+	}
+}
@@ -0,0 +1,22 @@
+/*
+ * SmallArray.h
+ *
+ * A Small Array is a Dynamic Array that stores up to N elements inside the array itself, and only allocates storage once it grows past them.
+ * As most arrays only ever hold a few elements, this avoids allocating them at all, and keeps their elements next to the rest of the object in the cache.
+ *
+ * It has the full Dynamic Array interface (Add, Insert, Remove, RemoveRange etc.), and works with every Array algorithm, e.g. SmallArray<int, 8> array = { 1, 2, 3 }.
+ * Note: Each Small Array is larger than a Dynamic Array by the size of its inline storage, and moving one with its elements inline moves each element.
+ *
+ * DISCLAIMER: This implementation is intended for portfolio/education purposes only.
+ * For production use, it is recommended to use boost::container::small_vector instead.
+ *
+ *  Copyright Peter Hoghton. All rights reserved.
+ */
+
+#pragma once
+
+#include "DynamicArray.h"
+
+// Dynamic Array with inline storage for N elements
+template<typename T, size_t N, typename Allocator = std::allocator<T>>
+using SmallArray = DynamicArray<T, Allocator, N>;
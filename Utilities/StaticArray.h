@@ -17,37 +17,43 @@
 #include "Array.h"
 
 template <typename T, size_t N>
-class StaticArray final : public Array<T>
+class StaticArray final : public ArrayBase<T, StaticArray<T, N>>
 {
+	using Base = ArrayBase<T, StaticArray<T, N>>;
+
 public:
-	using Array<T>::Copy;
-	using Array<T>::Fill;
-	using Array<T>::Move;
+	using Base::Copy;
+	using Base::Fill;
+	using Base::Move;
+	using Base::Sort;
 
 	// Default constructor
 	StaticArray() = default;
 
 	// Copy constructor
-	StaticArray(const StaticArray& other) : StaticArray(other.Data(), N) {}
+	// Note: Copies and moves are defaulted so that Static Arrays of trivially copyable elements are themselves trivially copyable.
+	constexpr StaticArray(const StaticArray& other) = default;
 
 	// Move constructor
-	StaticArray(StaticArray&& other) noexcept : StaticArray(other.Data(), N, true) {}
+	constexpr StaticArray(StaticArray&& other) noexcept = default;
 
 	// Conversion copy constructor from other Array
-	StaticArray(const Array<T>& other) : StaticArray(other.Data(), other.Size()) {}
+	template<typename OtherDerived>
+	constexpr StaticArray(const ArrayBase<T, OtherDerived>& other) : StaticArray(other.Data(), other.Size()) {}
 
 	// Conversion move constructor from other Array
-	StaticArray(Array<T>&& other) : StaticArray(other.Data(), other.Size(), true) {}
+	template<typename OtherDerived>
+	constexpr StaticArray(ArrayBase<T, OtherDerived>&& other) : StaticArray(other.Data(), other.Size(), true) {}
 
 	// Conversion copy constructor from initializer list
-	StaticArray(const std::initializer_list<T>& list) : StaticArray(list.begin(), list.size()) {}
+	constexpr StaticArray(const std::initializer_list<T>& list) : StaticArray(list.begin(), list.size()) {}
 
 	// Conversion copy constructor from c-style array
 	template <size_t M>
-	StaticArray(const T(&other)[M]) : StaticArray(other, M) {}
+	constexpr StaticArray(const T(&other)[M]) : StaticArray(other, M) {}
 
 	// Conversion copy constructor from raw array
-	StaticArray(const T* data, const size_t size)
+	constexpr StaticArray(const T* data, const size_t size)
 	{
 		Copy(data, size);
 		if (N > size)
@@ -57,7 +63,7 @@ public:
 	}
 
 	// Conversion copy/move constructor from raw array
-	StaticArray(T* data, const size_t size, const bool move = false)
+	constexpr StaticArray(T* data, const size_t size, const bool move = false)
 	{
 		move ? Move(data, size) : Copy(data, size);
 		if (N > size)
@@ -70,21 +76,14 @@ public:
 	~StaticArray() = default;
 
 	// Copy assignment operator
-	StaticArray& operator=(const StaticArray& other)
-	{
-		Copy(other.Data(), N);
-		return *this;
-	}
+	constexpr StaticArray& operator=(const StaticArray& other) = default;
 
 	// Move assignment operator
-	StaticArray& operator=(StaticArray&& other) noexcept
-	{
-		Move(other.Data(), N);
-		return *this;
-	}
+	constexpr StaticArray& operator=(StaticArray&& other) noexcept = default;
 
 	// Conversion copy assignment operator from other Array
-	StaticArray& operator=(const Array<T>& other)
+	template<typename OtherDerived>
+	constexpr StaticArray& operator=(const ArrayBase<T, OtherDerived>& other)
 	{
 		Copy(other.Data(), other.Size());
 		if (N > other.Size())
@@ -95,7 +94,8 @@ public:
 	}
 
 	// Conversion move assignment operator from other Array
-	StaticArray& operator=(Array<T>&& other)
+	template<typename OtherDerived>
+	constexpr StaticArray& operator=(ArrayBase<T, OtherDerived>&& other)
 	{
 		Move(other.Data(), other.Size());
 		if (N > other.Size())
@@ -106,7 +106,7 @@ public:
 	}
 
 	// Conversion copy assignment operator from initializer list
-	StaticArray& operator=(const std::initializer_list<T>& list)
+	constexpr StaticArray& operator=(const std::initializer_list<T>& list)
 	{
 		Copy(list.begin(), list.size());
 		if (N > list.size())
@@ -118,7 +118,7 @@ public:
 
 	// Conversion copy assignment operator from c-style array
 	template <size_t M>
-	StaticArray& operator=(const T(&other)[M])
+	constexpr StaticArray& operator=(const T(&other)[M])
 	{
 		Copy(other, M);
 		if (N > M)
@@ -130,56 +130,94 @@ public:
 
 	// Addition operator - concatenates two Static Arrays
 	template <size_t M>
-	StaticArray<T, N + M> operator+(const StaticArray<T, M>& other) const
+	constexpr StaticArray<T, N + M> operator+(const StaticArray<T, M>& other) const
 	{
 		return Concatenate<T, N, M>(m_data, other.Data());
 	}
 
 	// Addition operator - concatenates a Static Array and a c-style array
 	template <size_t M>
-	StaticArray<T, N + M> operator+(const T(&other)[M]) const
+	constexpr StaticArray<T, N + M> operator+(const T(&other)[M]) const
 	{
 		return Concatenate<T, N, M>(m_data, other);
 	}
 
 	// Addition operator - concatenates a c-style array and a Static Array
 	template <typename T, size_t M, size_t N>
-	friend StaticArray<T, M + N> operator+(const T(&left)[M], const StaticArray<T, N>& right);
+	friend constexpr StaticArray<T, M + N> operator+(const T(&left)[M], const StaticArray<T, N>& right);
 
 	// Returns a pointer to the first element of the array
-	T* Data() override
+	constexpr T* Data()
 	{
 		return m_data;
 	}
 
 	// Returns a pointer to the first element of the array (const version)
-	const T* Data() const override
+	constexpr const T* Data() const
 	{
 		return m_data;
 	}
 
 	// Removes all elements from the array
-	bool RemoveAll() override
+	constexpr bool RemoveAll()
 	{
 		return Fill(); // Resets all elements to default values
 	}
 
 	// Returns the size of the array
-	const size_t Size() const override
+	constexpr const size_t Size() const
 	{
 		return N;
 	}
 
+	// Sorts the elements of the array in either ascending (default) or descending order
+	// Note: Small arrays of cheaply copied elements are sorted using a sorting network generated at compile time for N elements.
+	// Note: In constant expressions the sorting network is skipped, as it is cached in a static local.
+	constexpr bool Sort(const SortOrder order = SortOrder::Ascending, const size_t from = 0, const size_t to = Base::MaxSize(), const size_t insertionSortThreshold = Base::DefaultInsertionSortThreshold())
+	{
+		if constexpr (Base::template NetworkSortable<N>())
+		{
+			if (!std::is_constant_evaluated() && from == 0 && (to == Base::MaxSize() || to == N - 1))
+			{
+				if (order == SortOrder::Ascending)
+				{
+					return Base::template NetworkSort<N>(Base::template OrderPredicate<SortOrder::Ascending>(), m_data);
+				}
+				return Base::template NetworkSort<N>(Base::template OrderPredicate<SortOrder::Descending>(), m_data);
+			}
+		}
+		return Base::Sort(order, from, to, insertionSortThreshold);
+	}
+
+	// Sorts the elements of the array based on the given predicate
+	// Note: Small arrays of cheaply copied elements are sorted using a sorting network generated at compile time for N elements.
+	// Note: In constant expressions the sorting network is skipped, as it is cached in a static local.
+	template<typename Predicate>
+	constexpr bool Sort(const Predicate& predicate, const size_t from = 0, const size_t to = Base::MaxSize(), const size_t insertionSortThreshold = Base::DefaultInsertionSortThreshold())
+	{
+		if constexpr (Base::template NetworkSortable<N>())
+		{
+			if (!std::is_constant_evaluated() && from == 0 && (to == Base::MaxSize() || to == N - 1))
+			{
+				return Base::template NetworkSort<N>(predicate, m_data);
+			}
+		}
+		return Base::Sort(predicate, from, to, insertionSortThreshold);
+	}
+
 	// Returns the size of the array (constexpr)
 	constexpr size_t StaticSize() const
 	{
 		return N;
 	}
 
+	// Note: The data is public, like std::array, so that Static Arrays are structural types usable as template arguments.
+	T m_data[N]; // The array data
+
 private:
 	// Concatenates the two arrays and returns the result
 	template <typename T, size_t N, size_t M>
-	static StaticArray<T, N + M> Concatenate(const T* left, const T* right)
+	static constexpr StaticArray<T, N + M> Concatenate(const T* left, const T* right)
 	{
 		StaticArray<T, N + M> result;
 
@@ -188,13 +226,11 @@ private:
 
 		return result;
 	}
-
-	T m_data[N]; // The array data
 };
 
 // Special case for size 0 array
 template <typename T>
-class StaticArray<T, 0> : public Array<T>
+class StaticArray<T, 0> : public ArrayBase<T, StaticArray<T, 0>>
 {
 public:
 	//Default constructor
@@ -207,10 +243,12 @@ public:
 	StaticArray(StaticArray&& other) noexcept = delete;
 
 	// Conversion copy constructor from other Array
-	StaticArray(const Array<T>& other) = delete;
+	template<typename OtherDerived>
+	StaticArray(const ArrayBase<T, OtherDerived>& other) = delete;
 
 	// Conversion move constructor from other Array
-	StaticArray(Array<T>&& other) = delete;
+	template<typename OtherDerived>
+	StaticArray(ArrayBase<T, OtherDerived>&& other) = delete;
 
 	// Conversion copy constructor from initializer list
 	StaticArray(const std::initializer_list<T>& list) = delete;
@@ -235,10 +273,12 @@ public:
 	StaticArray& operator=(StaticArray&& other) noexcept = delete;
 
 	// Conversion copy assignment operator from other Array
-	StaticArray& operator=(const Array<T>& other) = delete;
+	template<typename OtherDerived>
+	StaticArray& operator=(const ArrayBase<T, OtherDerived>& other) = delete;
 
 	// Conversion move assignment operator from other Array
-	StaticArray& operator=(Array<T>&& other) = delete;
+	template<typename OtherDerived>
+	StaticArray& operator=(ArrayBase<T, OtherDerived>&& other) = delete;
 
 	// Conversion copy assignment operator from initializer list
 	StaticArray& operator=(const std::initializer_list<T>& list) = delete;
@@ -249,38 +289,38 @@ public:
 
 	// Addition operator - concatenates two Static Arrays
 	template <size_t M>
-	StaticArray<T, M> operator+(const StaticArray<T, M>& other) const
+	constexpr StaticArray<T, M> operator+(const StaticArray<T, M>& other) const
 	{
 		return other;
 	}
 
 	// Addition operator - concatenates a Static Array and a c-style array
 	template <size_t M>
-	StaticArray<T, M> operator+(const T(&other)[M]) const
+	constexpr StaticArray<T, M> operator+(const T(&other)[M]) const
 	{
 		return other;
 	}
 
 	// Returns a pointer to the first element of the array
-	T* Data() override
+	constexpr T* Data()
 	{
 		return nullptr;
 	}
 
 	// Returns a pointer to the first element of the array (const version)
-	const T* Data() const override
+	constexpr const T* Data() const
 	{
 		return nullptr;
 	}
 
 	// Removes all elements from the array
-	bool RemoveAll() override
+	constexpr bool RemoveAll()
 	{
 		return false;
 	}
 
 	// Returns the size of the array
-	const size_t Size() const override
+	constexpr const size_t Size() const
 	{
 		return 0;
 	}
@@ -294,14 +334,14 @@ public:
 
 // Addition operator - concatenates a c-style array and a Static Array
 template <typename T, size_t M, size_t N>
-StaticArray<T, M + N> operator+(const T(&left)[M], const StaticArray<T, N>& right)
+constexpr StaticArray<T, M + N> operator+(const T(&left)[M], const StaticArray<T, N>& right)
 {
 	return StaticArray<T, M + N>::template Concatenate<T, M, N>(left, right.m_data);
 }
 
 // Addition operator - concatenates a c-style array and a Static Array
 template <typename T, size_t M>
-StaticArray<T, M> operator+(const T(&left)[M], const StaticArray<T, 0>& right)
+constexpr StaticArray<T, M> operator+(const T(&left)[M], const StaticArray<T, 0>& right)
 {
 	return StaticArray<T, M>(left);
 }
\ No newline at end of file
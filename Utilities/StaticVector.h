@@ -0,0 +1,602 @@
+/*
+ * StaticVector.h
+ *
+ * A Static Vector stores up to N elements inside the vector itself like a Static Array, but tracks its own size like a Dynamic Array, so it never allocates.
+ * Its slots are left uninitialized until elements are added to them, and adding more than N elements throws std::length_error instead of growing.
+ *
+ * It has the Dynamic Array interface for adding and removing elements (Add, Emplace, Insert, Remove etc.), and works with every Array algorithm.
+ * Note: These methods are constexpr, so a Static Vector can be built in a constant expression. Only vectors of trivial types can be stored in constexpr variables,
+ * as every slot must be initialized in a constant, so their storage is value initialized during constant evaluation.
+ *
+ * DISCLAIMER: This implementation is intended for portfolio/education purposes only.
+ * For production use, it is recommended to use boost::container::static_vector instead.
+ *
+ *  Copyright Peter Hoghton. All rights reserved.
+ */
+
+#pragma once
+
+#include "Array.h"
+
+// Storage for the elements of a Static Vector, which are only constructed as they are added
+// Note: The union stops the elements from being constructed and destroyed with the storage.
+template<typename T, size_t N, bool Trivial = std::is_trivial_v<T>>
+struct StaticVectorStorage
+{
+	// Default constructor - leaves the storage uninitialized
+	constexpr StaticVectorStorage() {}
+
+	// Default destructor - the vector destroys its elements
+	constexpr ~StaticVectorStorage() {}
+
+	union
+	{
+		T m_data[N]; // The storage for the elements
+	};
+};
+
+// Storage for the elements of a Static Vector of trivial types, which don't need constructing
+template<typename T, size_t N>
+struct StaticVectorStorage<T, N, true>
+{
+	// Default constructor - leaves the storage uninitialized, unless it is being constant evaluated
+	constexpr StaticVectorStorage()
+	{
+		if (std::is_constant_evaluated())
+		{
+			std::fill(m_data, m_data + N, T{});
+		}
+	}
+
+	T m_data[N]; // The storage for the elements
+};
+
+template <typename T, size_t N>
+class StaticVector final : public ArrayBase<T, StaticVector<T, N>>
+{
+	static_assert(N > 0, "Static Vector capacity must be greater than 0");
+
+	using Base = ArrayBase<T, StaticVector<T, N>>;
+
+public:
+	using Base::BoundsCheck;
+	using Base::MaxSize;
+
+	// Default constructor
+	constexpr StaticVector() = default;
+
+	// Copy constructor
+	constexpr StaticVector(const StaticVector& other) : StaticVector(other.Data(), other.m_size) {}
+
+	// Move constructor
+	// Note: The elements are moved, and the other vector is left empty.
+	constexpr StaticVector(StaticVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) : StaticVector(other.Data(), other.m_size, true)
+	{
+		other.Truncate(0);
+	}
+
+	// Conversion copy constructor from other Array
+	template<typename OtherDerived>
+	constexpr StaticVector(const ArrayBase<T, OtherDerived>& other) : StaticVector(other.Data(), other.Size()) {}
+
+	// Conversion move constructor from other Array
+	template<typename OtherDerived>
+	constexpr StaticVector(ArrayBase<T, OtherDerived>&& other) : StaticVector(other.Data(), other.Size(), true) {}
+
+	// Conversion copy constructor from initializer list
+	constexpr StaticVector(const std::initializer_list<T>& list) : StaticVector(list.begin(), list.size()) {}
+
+	// Conversion copy constructor from c-style array
+	template <size_t M>
+	constexpr StaticVector(const T(&other)[M]) : StaticVector(other, M) {}
+
+	// Conversion copy constructor from raw array
+	constexpr StaticVector(const T* data, const size_t size)
+	{
+		Grow(0, size);
+		Construct(0, const_cast<T*>(data), size, false);
+		m_size = size;
+	}
+
+	// Conversion copy/move constructor from raw array
+	constexpr StaticVector(T* data, const size_t size, const bool move = false)
+	{
+		Grow(0, size);
+		Construct(0, data, size, move);
+		m_size = size;
+	}
+
+	// Default destructor
+	constexpr ~StaticVector()
+	{
+		Destroy(0, m_size);
+	}
+
+	// Copy assignment operator
+	constexpr StaticVector& operator=(const StaticVector& other)
+	{
+		if (this != &other)
+		{
+			Assign(const_cast<T*>(other.Data()), other.m_size, false);
+		}
+		return *this;
+	}
+
+	// Move assignment operator
+	// Note: The elements are moved, and the other vector is left empty.
+	constexpr StaticVector& operator=(StaticVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+	{
+		if (this != &other)
+		{
+			Assign(other.Data(), other.m_size, true);
+			other.Truncate(0);
+		}
+		return *this;
+	}
+
+	// Conversion copy assignment operator from other Array
+	template<typename OtherDerived>
+	constexpr StaticVector& operator=(const ArrayBase<T, OtherDerived>& other)
+	{
+		Assign(const_cast<T*>(other.Data()), other.Size(), false);
+		return *this;
+	}
+
+	// Conversion move assignment operator from other Array
+	template<typename OtherDerived>
+	constexpr StaticVector& operator=(ArrayBase<T, OtherDerived>&& other)
+	{
+		Assign(other.Data(), other.Size(), true);
+		return *this;
+	}
+
+	// Conversion copy assignment operator from initializer list
+	constexpr StaticVector& operator=(const std::initializer_list<T>& list)
+	{
+		Assign(const_cast<T*>(list.begin()), list.size(), false);
+		return *this;
+	}
+
+	// Conversion copy assignment operator from c-style array
+	template <size_t M>
+	constexpr StaticVector& operator=(const T(&other)[M])
+	{
+		Assign(const_cast<T*>(other), M, false);
+		return *this;
+	}
+
+	// Addition assignment operator - concatenates the Static Vector and another Array
+	template<typename OtherDerived>
+	constexpr StaticVector& operator+=(const ArrayBase<T, OtherDerived>& other)
+	{
+		Add(other);
+		return *this;
+	}
+
+	// Addition assignment operator - concatenates the Static Vector and an initializer list
+	constexpr StaticVector& operator+=(const std::initializer_list<T>& list)
+	{
+		Add(list.begin(), list.size());
+		return *this;
+	}
+
+	// Addition assignment operator - concatenates the Static Vector and a c-style array
+	template <size_t M>
+	constexpr StaticVector& operator+=(const T(&other)[M])
+	{
+		Add(other);
+		return *this;
+	}
+
+	// Adds an element to the end of the vector
+	constexpr void Add(const T& element)
+	{
+		Insert(m_size, element);
+	}
+
+	// Adds another Array to the end of the vector
+	template<typename OtherDerived>
+	constexpr bool Add(const ArrayBase<T, OtherDerived>& other)
+	{
+		return Add(other.Data(), other.Size());
+	}
+
+	// Adds a c-style array to the end of the vector
+	template <size_t M>
+	constexpr bool Add(const T(&other)[M])
+	{
+		return Add(other, M);
+	}
+
+	// Adds a raw array to the end of the vector
+	constexpr bool Add(const T* data, const size_t size)
+	{
+		return Insert(m_size, data, size);
+	}
+
+	// Returns the capacity of the vector
+	static constexpr size_t Capacity()
+	{
+		return N;
+	}
+
+	// Deep copies the elements from the raw array
+	// Note: The vector grows to fit if necessary, and any elements between its previous size and the offset are default initialized.
+	constexpr bool Copy(const T* data, const size_t size, const size_t offset = 0)
+	{
+		return CopyOrMove(const_cast<T*>(data), size, offset, false);
+	}
+
+	// Returns a pointer to the first element of the vector
+	constexpr T* Data()
+	{
+		return m_storage.m_data;
+	}
+
+	// Returns a pointer to the first element of the vector (const version)
+	constexpr const T* Data() const
+	{
+		return m_storage.m_data;
+	}
+
+	// Constructs an element at the end of the vector
+	template<typename... Args>
+	constexpr void Emplace(Args&&... args)
+	{
+		EmplaceAt(m_size, std::forward<Args>(args)...);
+	}
+
+	// Constructs an element at the specified index
+	template<typename... Args>
+	constexpr void EmplaceAt(const size_t index, Args&&... args)
+	{
+		Grow(index);
+		std::construct_at(Data() + index, std::forward<Args>(args)...);
+		++m_size;
+	}
+
+	// Fills the vector with the given value
+	// Note: By default the vector is filled up to its capacity. It grows to fit if necessary, and any elements between its previous size and the range are default initialized.
+	constexpr bool Fill(const T& value = T{}, const size_t from = 0, const size_t to = MaxSize())
+	{
+		const size_t size = (to == MaxSize()) ? N : to;
+		const size_t constructed = PreFill(value, from, size);
+		if (constructed > from)
+		{
+			std::fill(Data() + from, Data() + constructed, value);
+		}
+		return size > from;
+	}
+
+	// Fills the vector with the given value using the given execution policy
+	// Note: By default the vector is filled up to its capacity. It grows to fit if necessary, and any elements between its previous size and the range are default initialized.
+	bool Fill(const ExecutionPolicy policy, const T& value = T{}, const size_t from = 0, const size_t to = MaxSize())
+	{
+		const size_t size = (to == MaxSize()) ? N : to;
+		const size_t constructed = PreFill(value, from, size);
+		return (constructed > from && Base::Fill(policy, value, from, constructed)) || size > constructed;
+	}
+
+	// Returns whether the vector is full, so that adding another element would throw
+	constexpr bool Full() const
+	{
+		return m_size == N;
+	}
+
+	// Inserts an element at the specified index
+	constexpr void Insert(const size_t index, const T& element)
+	{
+		// The element is copied first if it's an element of the vector, as it could be shifted to make room
+		if (index < m_size && Owns(&element))
+		{
+			T copy = element;
+			Grow(index);
+			std::construct_at(Data() + index, std::move(copy));
+			++m_size;
+			return;
+		}
+
+		Grow(index);
+		std::construct_at(Data() + index, element);
+		++m_size;
+	}
+
+	// Inserts another Array at the specified index
+	template<typename OtherDerived>
+	constexpr bool Insert(const size_t index, const ArrayBase<T, OtherDerived>& other)
+	{
+		return Insert(index, other.Data(), other.Size());
+	}
+
+	// Inserts a c-style array at the specified index
+	template <size_t M>
+	constexpr bool Insert(const size_t index, const T(&other)[M])
+	{
+		return Insert(index, other, M);
+	}
+
+	// Inserts a raw array at the specified index
+	constexpr bool Insert(const size_t index, const T* data, const size_t size)
+	{
+		// Elements of the vector could be shifted before they are copied, so they are appended to the end first and then rotated into place
+		if (index < m_size && size > 0 && Owns(data))
+		{
+			Grow(m_size, size);
+			Construct(m_size, const_cast<T*>(data), size, false);
+			m_size += size;
+			std::rotate(Data() + index, Data() + m_size - size, Data() + m_size);
+			return true;
+		}
+
+		Grow(index, size);
+		Construct(index, const_cast<T*>(data), size, false);
+		m_size += size;
+
+		return size > 0;
+	}
+
+	// Moves the elements from the raw array
+	// Note: The vector grows to fit if necessary, and any elements between its previous size and the offset are default initialized.
+	constexpr bool Move(T* data, const size_t size, const size_t offset = 0)
+	{
+		return CopyOrMove(data, size, offset, true);
+	}
+
+	// Removes all occurrences of the given value from the vector
+	// Note: Arithmetic element types are removed using vectorized instructions, except in constant expressions.
+	constexpr bool Remove(const T& value)
+	{
+		if constexpr (Simd::Arithmetic<T>)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				return Truncate(Simd::Remove(Data(), m_size, value));
+			}
+		}
+
+		// The value is copied first as it may be an element of the vector, which could be overwritten
+		const T copy = value;
+		return RemoveIf([&](const T& element) { return element == copy; }) > 0;
+	}
+
+	// Removes all occurrences of nullptr from the vector
+	constexpr bool Remove(std::nullptr_t)
+	{
+		return RemoveIf([](const T& element) { return element == nullptr; }) > 0;
+	}
+
+	// Removes all elements that satisfy the predicate from the vector
+	template<typename Predicate>
+	constexpr bool Remove(const Predicate& predicate)
+	{
+		return RemoveIf(predicate) > 0;
+	}
+
+	// Removes all elements from the vector
+	constexpr bool RemoveAll()
+	{
+		return Truncate(0);
+	}
+
+	// Removes the element at the specified index
+	constexpr void RemoveAt(const size_t index)
+	{
+		RemoveRange(index, index);
+	}
+
+	// Removes all elements that satisfy the predicate from the vector, and returns the number of elements removed
+	// Note: The remaining elements are moved forward in a single pass keeping their order.
+	template<typename Predicate>
+	constexpr size_t RemoveIf(const Predicate& predicate)
+	{
+		T* data = Data();
+		size_t index = 0;
+		while (index < m_size && !predicate(data[index]))
+		{
+			++index;
+		}
+
+		for (size_t i = index + 1; i < m_size; ++i)
+		{
+			if (!predicate(data[i]))
+			{
+				data[index++] = std::move(data[i]);
+			}
+		}
+
+		const size_t count = m_size - index;
+		Truncate(index);
+		return count;
+	}
+
+	// Remove the elements within the specified range from the vector
+	constexpr bool RemoveRange(const size_t from, const size_t to)
+	{
+		BoundsCheck(from);
+		BoundsCheck(to);
+
+		size_t count = to - from + 1;
+		if (count > 0 && from < m_size)
+		{
+			count = (count < m_size - from) ? count : m_size - from;
+			std::move(Data() + from + count, Data() + m_size, Data() + from);
+			return Truncate(m_size - count);
+		}
+
+		return false;
+	}
+
+	// Returns the size of the vector
+	constexpr const size_t Size() const
+	{
+		return m_size;
+	}
+
+private:
+	// Replaces the elements with those from the raw array
+	constexpr void Assign(T* data, const size_t size, const bool move)
+	{
+		if (size > N)
+		{
+			throw std::length_error("Static Vector capacity exceeded");
+		}
+
+		Truncate(0);
+		Construct(0, data, size, move);
+		m_size = size;
+	}
+
+	// Copy or move constructs elements from the raw array into the uninitialized storage from the specified index
+	constexpr void Construct(const size_t index, T* data, const size_t size, const bool move)
+	{
+		for (size_t i = 0; i < size; ++i)
+		{
+			if (move)
+			{
+				std::construct_at(Data() + index + i, std::move(data[i]));
+			}
+			else
+			{
+				std::construct_at(Data() + index + i, data[i]);
+			}
+		}
+	}
+
+	// Default initializes the elements from the end of the vector up to the specified size
+	// Note: Types that can't be default constructed can only be added to the end of the vector.
+	constexpr bool ConstructDefault(const size_t size)
+	{
+		if (size <= m_size)
+		{
+			return false;
+		}
+
+		if constexpr (std::is_default_constructible_v<T>)
+		{
+			for (size_t i = m_size; i < size; ++i)
+			{
+				std::construct_at(Data() + i);
+			}
+			m_size = size;
+			return true;
+		}
+		else
+		{
+			throw std::out_of_range("Array index out of bounds");
+		}
+	}
+
+	// Copies or moves the elements from the raw array, assigning to existing elements and constructing the rest
+	constexpr bool CopyOrMove(T* data, const size_t size, const size_t offset, const bool move)
+	{
+		if (data == Data() + offset && offset + size <= m_size) // Check for self-assignment
+		{
+			return false;
+		}
+
+		if (offset > N || size > N - offset)
+		{
+			throw std::length_error("Static Vector capacity exceeded");
+		}
+
+		const bool dirty = ConstructDefault(offset);
+		const size_t assigned = (offset + size < m_size) ? size : m_size - offset;
+		move ? std::move(data, data + assigned, Data() + offset) : std::copy(data, data + assigned, Data() + offset);
+		Construct(offset + assigned, data + assigned, size - assigned, move);
+
+		m_size = (offset + size > m_size) ? offset + size : m_size;
+		return size > 0 || dirty;
+	}
+
+	// Destroys the elements within the specified range, leaving uninitialized storage
+	constexpr void Destroy(const size_t from, const size_t to)
+	{
+		if constexpr (!std::is_trivially_destructible_v<T>)
+		{
+			std::destroy(Data() + from, Data() + to);
+		}
+	}
+
+	// Makes room for the given number of elements at the specified index, throwing if the vector doesn't have the capacity
+	// Note: The elements from the index onwards are shifted to make room, and the gap is left as uninitialized storage for the caller to construct.
+	constexpr void Grow(const size_t index, const size_t amount = 1)
+	{
+		if (index != m_size)
+		{
+			BoundsCheck(index);
+		}
+
+		if (amount > N - m_size)
+		{
+			throw std::length_error("Static Vector capacity exceeded");
+		}
+
+		if (index < m_size && amount > 0)
+		{
+			// Elements shifted past the end are constructed in the uninitialized storage, and the rest are assigned
+			T* data = Data();
+			const size_t constructed = (amount < m_size - index) ? amount : m_size - index;
+			for (size_t i = m_size; i > m_size - constructed; --i)
+			{
+				std::construct_at(data + i - 1 + amount, std::move(data[i - 1]));
+			}
+			std::move_backward(data + index, data + m_size - constructed, data + m_size + amount - constructed);
+			Destroy(index, index + constructed);
+		}
+	}
+
+	// Returns whether the pointer points to an element of the vector
+	constexpr bool Owns(const T* pointer) const
+	{
+		// Pointers into different arrays can't be ordered in constant expressions, so they are compared for equality with each element instead
+		if (std::is_constant_evaluated())
+		{
+			for (size_t i = 0; i < m_size; ++i)
+			{
+				if (pointer == Data() + i)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		return std::less_equal<const T*>()(Data(), pointer) && std::less<const T*>()(pointer, Data() + m_size);
+	}
+
+	// Default initializes any elements before the range prior to a fill, constructs the elements of the range past the end of the vector from the value,
+	// and returns the end of the elements that were already constructed
+	constexpr size_t PreFill(const T& value, const size_t from, const size_t size)
+	{
+		if (from > size || size > N)
+		{
+			throw std::out_of_range("Array index out of bounds");
+		}
+
+		ConstructDefault(from);
+
+		const size_t constructed = (size < m_size) ? size : m_size;
+		for (size_t i = constructed; i < size; ++i)
+		{
+			std::construct_at(Data() + i, value);
+		}
+		m_size = (size > m_size) ? size : m_size;
+		return constructed;
+	}
+
+	// Reduces the size of the vector to the given size
+	// Note: Elements past the new size are destroyed so that any resources they hold are released.
+	constexpr bool Truncate(const size_t size)
+	{
+		if (size < m_size)
+		{
+			Destroy(size, m_size);
+			m_size = size;
+			return true;
+		}
+		return false;
+	}
+
+	StaticVectorStorage<T, N> m_storage; // The storage for the elements, which are only constructed within the size of the vector
+	size_t m_size = 0; // Size of the vector
+};
\ No newline at end of file
@@ -0,0 +1,162 @@
+#include "UnitTestAllocators.h"
+
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Allocators.h"
+#include "DynamicArray.h"
+
+namespace UnitTests
+{
+	void UnitTestAllocatorsArena();
+	void UnitTestAllocatorsPool();
+	void UnitTestAllocatorsDynamicArray();
+
+	void UnitTestAllocators()
+	{
+		UnitTestAllocatorsArena();
+		UnitTestAllocatorsPool();
+		UnitTestAllocatorsDynamicArray();
+	}
+
+	void UnitTestAllocatorsArena()
+	{
+		// Allocate method
+		Arena a(1024);
+		assert(a.Capacity() == 0); // Blocks are only allocated when they are needed
+
+		void* b = a.Allocate(10, 1);
+		void* c = a.Allocate(8, 64);
+		assert(b != nullptr);
+		assert(reinterpret_cast<uintptr_t>(c) % 64 == 0);
+		assert(static_cast<char*>(c) >= static_cast<char*>(b) + 10); // Allocations don't overlap
+		assert(a.Capacity() == 1024);
+
+		void* d = a.Allocate(4096); // Larger than a block, so it gets a block of its own
+		assert(d != nullptr);
+		assert(a.Capacity() > 4096 + 1024);
+
+		// Deallocate method
+		void* e = a.Allocate(16);
+		a.Deallocate(e, 16); // The most recent allocation is freed
+		assert(a.Allocate(16) == e);
+
+		a.Deallocate(c, 8); // Other allocations are only freed by a reset
+		assert(a.Allocate(16) != c);
+
+		// Reset method
+		const size_t f = a.Capacity();
+		a.Reset();
+		assert(a.Allocate(10, 1) == b); // The blocks are reused
+		a.Allocate(4096);
+		assert(a.Capacity() == f);
+	}
+
+	void UnitTestAllocatorsPool()
+	{
+		// Allocate method
+		Pool a;
+		void* b = a.Allocate(24);
+		void* c = a.Allocate(24);
+		assert(b != c);
+		assert(reinterpret_cast<uintptr_t>(b) % 16 == 0);
+
+		void* d = a.Allocate(100000); // Larger than the largest size class
+		assert(d != nullptr);
+
+		void* e = a.Allocate(8, 64); // Over-aligned
+		assert(reinterpret_cast<uintptr_t>(e) % 64 == 0);
+
+		// Deallocate method
+		a.Deallocate(b, 24);
+		assert(a.Allocate(32) == b); // Freed memory is reused by the same size class
+		a.Deallocate(d, 100000);
+		a.Deallocate(e, 8, 64);
+
+		// Concurrent use
+		std::vector<std::thread> f;
+		for (int i = 0; i < 4; ++i)
+		{
+			f.emplace_back([&a, i]()
+			{
+				for (int j = 0; j < 1000; ++j)
+				{
+					const size_t size = 16 << ((i + j) % 6);
+					int* data = static_cast<int*>(a.Allocate(size));
+					data[0] = j;
+					assert(data[0] == j);
+					a.Deallocate(data, size);
+				}
+			});
+		}
+		for (std::thread& thread : f)
+		{
+			thread.join();
+		}
+	}
+
+	void UnitTestAllocatorsDynamicArray()
+	{
+		// Arena allocator
+		Arena a;
+		DynamicArray<int, ArenaAllocator<int>> b{ ArenaAllocator<int>(a) };
+		for (int i = 0; i < 1000; ++i)
+		{
+			b.Add(i);
+		}
+		assert(b.Size() == 1000);
+		assert(b[999] == 999);
+		assert(a.Capacity() > 0);
+
+		DynamicArray<std::string, ArenaAllocator<std::string>> c({ "a", "b", "c" }, ArenaAllocator<std::string>(a));
+		c.Add(std::string(100, 'd')); // Elements may allocate from elsewhere
+		assert(c.Size() == 4);
+		assert(c[3].size() == 100);
+
+		// Copy constructor - the copy uses the same arena
+		DynamicArray<int, ArenaAllocator<int>> d = b;
+		assert(d == b);
+
+		// Move assignment operator (same arena) - the storage is taken
+		const int* e = d.Data();
+		DynamicArray<int, ArenaAllocator<int>> f{ ArenaAllocator<int>(a) };
+		f = std::move(d);
+		assert(f.Data() == e);
+		assert(d.Size() == 0);
+
+		// Move assignment operator (different arena) - the elements are moved instead
+		Arena g;
+		DynamicArray<int, ArenaAllocator<int>> h{ ArenaAllocator<int>(g) };
+		h = std::move(f);
+		assert(h.Data() != e);
+		assert(h == b);
+		assert(f.Size() == 0);
+		h.Add(1000); // The storage is still allocated from the other arena
+		assert(h.Size() == 1001);
+
+		// Pool allocator
+		Pool i;
+		DynamicArray<DynamicArray<int, PoolAllocator<int>>, PoolAllocator<DynamicArray<int, PoolAllocator<int>>>> j{ PoolAllocator<int>(i) };
+		for (int k = 0; k < 100; ++k)
+		{
+			j.Emplace(PoolAllocator<int>(i));
+			j[k].Add(k);
+		}
+		assert(j.Size() == 100);
+		assert(j[99][0] == 99);
+
+		// Addition operator - the result uses the same pool
+		DynamicArray<int, PoolAllocator<int>> k({ 1, 2, 3 }, PoolAllocator<int>(i));
+		const int l[] = { 4, 5 };
+		DynamicArray<int, PoolAllocator<int>> m = k + l;
+		assert(m.Size() == 5);
+		assert(m[4] == 5);
+
+		DynamicArray<int, PoolAllocator<int>> n = l + k;
+		assert(n.Size() == 5);
+		assert(n[0] == 4);
+	}
+}
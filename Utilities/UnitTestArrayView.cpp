@@ -0,0 +1,160 @@
+#include "UnitTestArrayView.h"
+
+#include <cassert>
+#include <vector>
+
+#include "ArrayView.h"
+#include "DynamicArray.h"
+#include "StaticArray.h"
+
+namespace UnitTests
+{
+	void UnitTestArrayViewConstructors();
+	void UnitTestArrayViewAssignment();
+	void UnitTestArrayViewMethods();
+
+	void UnitTestArrayView()
+	{
+		UnitTestArrayViewConstructors();
+		UnitTestArrayViewAssignment();
+		UnitTestArrayViewMethods();
+	}
+
+	void UnitTestArrayViewConstructors()
+	{
+		// Default constructor
+		ArrayView<int> a;
+		assert(a.Size() == 0);
+		assert(a.Data() == nullptr);
+
+		// Copy constructor
+		StaticArray<int, 3> b = { 1, 2, 3 };
+		ArrayView<int> c = b;
+		ArrayView<int> d = c;
+		assert(d.Size() == 3);
+		assert(d.Data() == b.Data()); // Refers to the same elements
+
+		// Conversion constructor from other Array (Static Array)
+		StaticArray<int, 3> e = { 1, 2, 3 };
+		ArrayView f(e); // Deduced as ArrayView<int>
+		assert(f.Size() == 3);
+		f[0] = 4;
+		assert(e[0] == 4);
+
+		// Conversion constructor from other Array (Dynamic Array)
+		DynamicArray<int> g = { 1, 2, 3 };
+		ArrayView<int> h = g;
+		assert(h.Size() == 3);
+		assert(h.Data() == g.Data());
+		assert(h == g);
+
+		// Conversion constructor from other Array (const version)
+		const StaticArray<int, 3> i = { 1, 2, 3 };
+		ArrayView j(i); // Deduced as ArrayView<const int>
+		assert(j.Size() == 3);
+		assert(j[2] == 3);
+		ArrayView<const int> k = h; // Views of const elements can also refer to mutable arrays and views
+		assert(k.Data() == g.Data());
+
+		// Conversion constructor from c-style array
+		int l[] = { 1, 2, 3 };
+		ArrayView<int> m = l;
+		assert(m.Size() == 3);
+		assert(m[1] == 2);
+
+		// Conversion constructor from raw array
+		std::vector<int> n = { 1, 2, 3 }; // Using std::vector as an example, but can be used to view any array structure
+		ArrayView<int> o(n.data(), n.size());
+		assert(o.Size() == 3);
+		o[2] = 4;
+		assert(n[2] == 4);
+	}
+
+	void UnitTestArrayViewAssignment()
+	{
+		// Copy assignment operator
+		StaticArray<int, 3> a = { 1, 2, 3 };
+		DynamicArray<int> b = { 4, 5 };
+		ArrayView<int> c = a;
+		c = b; // Refers to the other elements, rather than copying them
+		assert(c.Size() == 2);
+		assert(c.Data() == b.Data());
+		assert(a[0] == 1);
+	}
+
+	void UnitTestArrayViewMethods()
+	{
+		// Count method
+		StaticArray<int, 6> a = { 1, 2, 1, 3, 1, 4 };
+		assert(a.Slice(1, 5).Count(1) == 2);
+
+		// Data method
+		StaticArray<int, 3> b = { 1, 2, 3 };
+		ArrayView<int> c = b.Slice(1);
+		assert(c.Data() == b.Data() + 1);
+
+		// Fill method
+		DynamicArray<int> d = { 1, 2, 3, 4 };
+		assert(d.Slice(1, 3).Fill(0));
+		assert(d == DynamicArray<int>({ 1, 0, 0, 4 }));
+
+		// Find method
+		StaticArray<int, 4> e = { 1, 2, 3, 4 };
+		const int* f = e.Slice(2).Find([](const int& element) { return element % 2 == 0; });
+		assert(f == e.Data() + 3);
+
+		// Index of method
+		StaticArray<int, 4> g = { 1, 2, 3, 2 };
+		assert(g.Slice(2).IndexOf(2) == 1); // Indices are relative to the view
+
+		// Remove all method
+		StaticArray<int, 3> h = { 1, 2, 3 };
+		assert(h.Slice(0, 2).RemoveAll()); // Resets the elements to default values, as a view cannot remove them
+		assert(h[0] == 0);
+		assert(h[1] == 0);
+		assert(h[2] == 3);
+
+		// Replace method
+		DynamicArray<int> i = { 1, 1, 1, 1 };
+		assert(i.Slice(2).Replace(1, 2));
+		assert(i == DynamicArray<int>({ 1, 1, 2, 2 }));
+
+		// Size method
+		DynamicArray<int> j = { 1, 2, 3 };
+		assert(j.Slice().Size() == 3);
+		assert(j.Slice(1, 1).Size() == 0);
+		assert(j.Slice(3).Size() == 0); // An empty slice may start at the end of the array
+
+		// Slice method
+		StaticArray<int, 5> k = { 1, 2, 3, 4, 5 };
+		ArrayView<int> l = k.Slice(1, 4);
+		ArrayView<int> m = l.Slice(1); // Slices of views refer to the original elements
+		assert(m.Size() == 2);
+		assert(m[0] == 3);
+		assert(m[1] == 4);
+		bool success = false;
+		try
+		{
+			l.Slice(0, 4); // Invalid - slice cannot extend past the end of the view
+		}
+		catch (const std::out_of_range&)
+		{
+			success = true;
+		}
+		assert(success);
+
+		const DynamicArray<int> n = { 1, 2, 3 };
+		ArrayView<const int> o = n.Slice(1); // Slices of const arrays are views of const elements
+		assert(o.Size() == 2);
+		assert(o[0] == 2);
+
+		// Sort method
+		StaticArray<int, 6> p = { 6, 5, 4, 3, 2, 1 };
+		assert(p.Slice(1, 5).Sort());
+		int q[] = { 6, 2, 3, 4, 5, 1 }; // Only the elements within the view are sorted
+		assert(p == q);
+		assert(p.Slice(1, 5).Sort(SortOrder::Descending));
+		int r[] = { 6, 5, 4, 3, 2, 1 };
+		assert(p == r);
+	}
+}
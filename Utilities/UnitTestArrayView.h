@@ -0,0 +1,6 @@
+#pragma once
+
+namespace UnitTests
+{
+	void UnitTestArrayView();
+}
\ No newline at end of file
@@ -1,10 +1,12 @@
 #include "UnitTestDynamicArray.h"
 
 #include <cassert>
-#include <ctime>
+#include <string>
 #include <vector>
 
+#include "ArrayView.h"
 #include "DynamicArray.h"
+#include "Random.h"
 #include "StaticArray.h"
 
 namespace UnitTests
@@ -106,6 +108,26 @@ namespace UnitTests
 		assert(q[0] == 1);
 		assert(q[1] == 2);
 		assert(q[2] == 3);
+
+		// Adapter to the runtime Array interface
+		DynamicArray<int> r = { 1, 2, 3 };
+		ArrayAdapter s(r);
+		Array<int>& t = s;
+		assert(t.Size() == 3);
+		assert(t[2] == 3);
+		assert(t == r);
+		assert(t.Fill(4, 3, 5)); // Forwarded to the Dynamic Array, which grows to fit
+		assert(r.Size() == 5);
+		assert(r[4] == 4);
+		DynamicArray<int> u = t;
+		assert(u == r);
+
+		// Move constructor (storage is taken from the other array, so no elements are moved)
+		DynamicArray<int> v = { 1, 2, 3 };
+		const int* w = v.Data();
+		DynamicArray<int> x = std::move(v);
+		assert(x.Data() == w);
+		assert(v.Data() == nullptr);
 	}
 
 	void UnitTestDynamicArrayAssignment()
@@ -221,6 +243,21 @@ namespace UnitTests
 		assert(q[3] == 4);
 		assert(q[4] == 5);
 		assert(q[5] == 6);
+
+		// Move assignment operator (storage is taken from the other array, so no elements are moved)
+		DynamicArray<int> t = { 1, 2, 3 };
+		DynamicArray<int> u;
+		const int* v = t.Data();
+		u = std::move(t);
+		assert(u.Data() == v);
+		assert(t.Data() == nullptr);
+
+		// Conversion copy assignment operator from a view of the same array
+		DynamicArray<std::string> w = { std::string(32, 'a'), std::string(32, 'b'), std::string(32, 'c'), std::string(32, 'd') };
+		w = w.Slice(1, 3);
+		assert(w.Size() == 2);
+		assert(w[0] == std::string(32, 'b'));
+		assert(w[1] == std::string(32, 'c'));
 	}
 
 	void UnitTestDynamicArrayOperators()
@@ -638,6 +675,8 @@ namespace UnitTests
 		DynamicArray<int> as = { 1, 2, 3 };
 		std::vector<int> at = { 1, 2, 3 }; // Using std::vector as an example, but can be used to compare with any array structure
 		assert(as.Equals(at.data(), at.size()));
+		at[2] = 4;
+		assert(!as.Equals(at.data(), at.size()));
 
 		// Fill method
 		DynamicArray<int> au(3);
@@ -645,6 +684,10 @@ namespace UnitTests
 		assert(au[0] == 1);
 		assert(au[1] == 1);
 		assert(au[2] == 1);
+		au.Fill(2, 1);
+		assert(au[0] == 1);
+		assert(au[1] == 2);
+		assert(au[2] == 2);
 
 		// Find method
 		DynamicArray<int> av = { 1, 2, 3 };
@@ -696,6 +739,7 @@ namespace UnitTests
 		assert(bf[0] == 3);
 		assert(bf[1] == 2);
 		assert(bf[2] == 1);
+		assert(!DynamicArray<int>().Reverse()); // Nothing to reverse
 
 		// Reverse find method
 		DynamicArray<int> bg = { 1, 2, 3 };
@@ -705,19 +749,20 @@ namespace UnitTests
 		// Reverse indexof method
 		DynamicArray<int> bh = { 1, 2, 2, 3 };
 		assert(bh.ReverseIndexOf(2) == 2);
+		assert(bh.ReverseIndexOf(1) == 0);
 		assert(bh.ReverseIndexOf(4) == bh.Size());
 		assert(bh.ReverseIndexOf([](const int& element) { return element < 3; }) == 2);
+		assert(bh.ReverseIndexOf([](const int& element) { return element < 2; }) == 0);
 
 		// Shuffle method
 		DynamicArray<int> bi = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
-		srand(static_cast<unsigned int>(time(nullptr))); // Seed random number generator
 		bi.Shuffle();
 		DynamicArray<int> bj = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
 		assert(bi != bj); // This may still assert due to the nature of randomness but would be extremely unlikely
 
 		// Sort method
 		DynamicArray<int> bk = { 3, 1, 2 };
-		bk.Sort(); // Insertion sort < 10 elements
+		bk.Sort(); // Sorting network < 10 elements
 		assert(bk[0] == 1);
 		assert(bk[1] == 2);
 		assert(bk[2] == 3);
@@ -747,5 +792,479 @@ namespace UnitTests
 		assert(bn[0] == 3);
 		assert(bn[1] == 2);
 		assert(bn[2] == 1);
+
+		// Sort method (large arrays)
+		DynamicArray<int> bo(1000); // Introspective sort with pattern detection (a predicate is given, so arithmetic elements aren't radix sorted)
+		for (int i = 0; i < 1000; ++i)
+		{
+			bo.Add(i < 500 ? i : 1000 - i); // Organ pipe
+		}
+		bo.Sort([](const int& a, const int& b) { return a < b; });
+		for (size_t i = 1; i < bo.Size(); ++i)
+		{
+			assert(bo[i - 1] <= bo[i]);
+		}
+		bo.Sort([](const int& a, const int& b) { return a > b; }); // Already sorted in reverse order
+		for (size_t i = 1; i < bo.Size(); ++i)
+		{
+			assert(bo[i - 1] >= bo[i]);
+		}
+		bo.Replace([](const int& element) { return element % 3 == 0; }, 7); // Many duplicates
+		bo.Shuffle();
+		bo.Sort([](const int& a, const int& b) { return a < b; });
+		for (size_t i = 1; i < bo.Size(); ++i)
+		{
+			assert(bo[i - 1] <= bo[i]);
+		}
+
+		DynamicArray<int> bp = { 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 10, 11, 12 };
+		bp.Sort(SortOrder::Ascending, 2, 8); // Sorts only the elements within the range (inclusive)
+		assert(bp[0] == 9);
+		assert(bp[1] == 8);
+		assert(bp[2] == 1);
+		assert(bp[8] == 7);
+		assert(bp[9] == 0);
+
+		// Sort method (execution policy)
+		DynamicArray<int> bq(100000); // Parallel sort
+		bq.Fill();
+		for (int i = 0; i < 100000; ++i)
+		{
+			bq[i] = (i * 7919) % 100003;
+		}
+		bq.Sort(ExecutionPolicy::Parallel, SortOrder::Ascending, 0, bq.Size() - 1, 1000);
+		for (size_t i = 1; i < bq.Size(); ++i)
+		{
+			assert(bq[i - 1] <= bq[i]);
+		}
+		bq.Sort(ExecutionPolicy::Parallel, [](const int& left, const int& right) { return left > right; }, 10, 99989);
+		assert(bq[0] == 0);
+		assert(bq[10] > bq[99989]);
+		assert(bq[99990] < bq[99999]);
+
+		// Sort method (arithmetic types)
+		DynamicArray<double> br(1000); // Radix sort >= 256 arithmetic elements
+		br.Fill();
+		for (int i = 0; i < 1000; ++i)
+		{
+			br[i] = (i * 7919 % 1000) - 500.5;
+		}
+		br[10] = std::numeric_limits<double>::quiet_NaN();
+		br[20] = -std::numeric_limits<double>::infinity();
+		br.Sort();
+		assert(br[0] == -std::numeric_limits<double>::infinity());
+		for (size_t i = 2; i < br.Size() - 1; ++i)
+		{
+			assert(br[i - 1] <= br[i]);
+		}
+		assert(br[999] != br[999]); // NaNs are always placed at the end
+		br.Sort(SortOrder::Descending);
+		assert(br[998] == -std::numeric_limits<double>::infinity());
+		assert(br[999] != br[999]);
+
+		DynamicArray<short> bs(1000);
+		bs.Fill();
+		for (int i = 0; i < 1000; ++i)
+		{
+			bs[i] = static_cast<short>(i % 2 == 0 ? i : -i);
+		}
+		bs.Sort(SortOrder::Descending);
+		assert(bs[0] == 998);
+		assert(bs[999] == -999);
+		for (size_t i = 1; i < bs.Size(); ++i)
+		{
+			assert(bs[i - 1] >= bs[i]);
+		}
+
+		// Stable sort method
+		DynamicArray<int> bt = { 31, 12, 22, 11, 32, 21, 13, 33, 23 };
+		bt.StableSort([](const int& left, const int& right) { return left / 10 < right / 10; }); // Equal elements keep their relative order
+		assert(bt[0] == 12);
+		assert(bt[1] == 11);
+		assert(bt[2] == 13);
+		assert(bt[3] == 22);
+		assert(bt[4] == 21);
+		assert(bt[5] == 23);
+		assert(bt[6] == 31);
+		assert(bt[7] == 32);
+		assert(bt[8] == 33);
+
+		DynamicArray<int> bu(1000); // Merges detected runs
+		bu.Fill();
+		for (int i = 0; i < 1000; ++i)
+		{
+			bu[i] = (i / 100 % 2 == 0) ? i : 2000 - i;
+		}
+		bu.StableSort(SortOrder::Descending, 100, 899);
+		for (size_t i = 101; i < 900; ++i)
+		{
+			assert(bu[i - 1] >= bu[i]);
+		}
+		assert(bu[0] == 0);
+		assert(bu[999] == 1001);
+
+		// Nth element method
+		DynamicArray<int> bv = { 3, 1, 2, 7, 10, 9, 6, 8, 5, 4, 11, 12 };
+		bv.NthElement(4);
+		assert(bv[4] == 5);
+		for (size_t i = 0; i < 4; ++i)
+		{
+			assert(bv[i] < 5);
+		}
+		for (size_t i = 5; i < bv.Size(); ++i)
+		{
+			assert(bv[i] > 5);
+		}
+		bv.NthElement(0, SortOrder::Descending);
+		assert(bv[0] == 12);
+
+		// Partial sort method
+		DynamicArray<int> bw = { 3, 1, 2, 7, 10, 9, 6, 8, 5, 4, 11, 12 };
+		bw.PartialSort(3);
+		assert(bw[0] == 1);
+		assert(bw[1] == 2);
+		assert(bw[2] == 3);
+		bw.PartialSort(2, [](const int& a, const int& b) { return a > b; });
+		assert(bw[0] == 12);
+		assert(bw[1] == 11);
+
+		// Top k method
+		DynamicArray<int> bx = { 3, 1, 2, 7, 10, 9, 6, 8, 5, 4, 11, 12 };
+		DynamicArray<int> by = bx.TopK(3);
+		assert(by.Size() == 3);
+		assert(by[0] == 12);
+		assert(by[1] == 11);
+		assert(by[2] == 10);
+		assert(bx[0] == 3); // Source array is left unchanged
+		by = bx.TopK(2, SortOrder::Ascending);
+		assert(by[0] == 1);
+		assert(by[1] == 2);
+		assert(bx.TopK(20).Size() == bx.Size());
+
+		// Batch lower bound method
+		DynamicArray<int> bz = { 1, 2, 2, 2, 3, 5 };
+		int ca[] = { 2, 0, 4, 6 };
+		size_t cb[4];
+		bz.BatchLowerBound(ca, 4, cb);
+		assert(cb[0] == 1);
+		assert(cb[1] == 0);
+		assert(cb[2] == 5);
+		assert(cb[3] == 6);
+
+		// Batch upper bound method
+		bz.BatchUpperBound(ca, 4, cb);
+		assert(cb[0] == 4);
+		assert(cb[1] == 0);
+		assert(cb[2] == 5);
+		assert(cb[3] == 6);
+
+		// Binary search method
+		assert(bz.BinarySearch(2) == 1);
+		assert(bz.BinarySearch(4) == bz.Size());
+		DynamicArray<int> cc = { 5, 3, 2, 2, 1 };
+		assert(cc.BinarySearch(2, SortOrder::Descending) == 2);
+		assert(cc.BinarySearch(3, [](const int& a, const int& b) { return a > b; }) == 1);
+
+		// Equal range method
+		DynamicArray<int> cd = { 1, 2, 2, 2, 3, 5 };
+		assert(cd.EqualRange(2).first == 1);
+		assert(cd.EqualRange(2).second == 4);
+		assert(cd.EqualRange(4).first == cd.EqualRange(4).second);
+
+		// Lower bound method
+		DynamicArray<int> ce = { 1, 2, 2, 2, 3, 5 };
+		assert(ce.LowerBound(2) == 1);
+		assert(ce.LowerBound(4) == 5);
+		assert(ce.LowerBound(6) == ce.Size());
+		assert(ce.LowerBound(2, SortOrder::Ascending, 2) == 2);
+
+		// Upper bound method
+		DynamicArray<int> cf = { 1, 2, 2, 2, 3, 5 };
+		assert(cf.UpperBound(2) == 4);
+		assert(cf.UpperBound(0) == 0);
+		assert(cf.UpperBound(5) == cf.Size());
+		assert(cf.UpperBound(2, SortOrder::Ascending, 0, 3) == 3);
+
+		// Count method (execution policy)
+		DynamicArray<int> cg = { 1, 2, 2, 2, 3 };
+		assert(cg.Count(ExecutionPolicy::Parallel, 2) == 3);
+		assert(cg.Count(ExecutionPolicy::ParallelUnsequenced, [](const int& element) { return element % 2 == 1; }) == 2);
+
+		DynamicArray<int*> ch(3);
+		ch.Fill(nullptr);
+		assert(ch.Count(ExecutionPolicy::Parallel, nullptr) == 3);
+
+		// Fill method (execution policy)
+		DynamicArray<int> ci(3);
+		ci.Fill(ExecutionPolicy::Parallel, 3);
+		assert(ci[0] == 3);
+		assert(ci[1] == 3);
+		assert(ci[2] == 3);
+
+		// Find method (execution policy)
+		DynamicArray<int> cj = { 1, 2, 3 };
+		assert(cj.Find(ExecutionPolicy::Parallel, [](const int& element) { return element > 1; }) == &cj[1]);
+		assert(!cj.Find(ExecutionPolicy::ParallelUnsequenced, [](const int& element) { return element > 3; }));
+
+		// Indexof method (execution policy)
+		DynamicArray<int> ck = { 1, 2, 3 };
+		assert(ck.IndexOf(ExecutionPolicy::Parallel, 2) == 1);
+		assert(ck.IndexOf(ExecutionPolicy::ParallelUnsequenced, [](const int& element) { return element > 2; }) == 2);
+
+		DynamicArray<int> cl(1 << 20); // Large enough to be split across worker threads
+		cl.Fill(ExecutionPolicy::Parallel, 0);
+		cl[(1 << 19) + 1] = 1;
+		cl[(1 << 20) - 1] = 1;
+		assert(cl.IndexOf(ExecutionPolicy::Parallel, 1) == (1 << 19) + 1);
+		assert(cl.IndexOf(ExecutionPolicy::ParallelUnsequenced, [](const int& element) { return element == 1; }) == (1 << 19) + 1);
+		assert(cl.Count(ExecutionPolicy::Parallel, 1) == 2);
+
+		// Replace method (execution policy)
+		DynamicArray<int> cm = { 1, 2, 3 };
+		cm.Replace(ExecutionPolicy::Parallel, 2, 4);
+		assert(cm[0] == 1);
+		assert(cm[1] == 4);
+		assert(cm[2] == 3);
+		cm.Replace(ExecutionPolicy::ParallelUnsequenced, [](const int& element) { return element % 2 == 1; }, 6);
+		assert(cm[0] == 6);
+		assert(cm[1] == 4);
+		assert(cm[2] == 6);
+
+		// Shuffle method (random engine)
+		DynamicArray<int> cn = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+		DynamicArray<int> co = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+		Random cp(42);
+		assert(cn.Shuffle(cp));
+		cp.Seed(42);
+		assert(co.Shuffle(cp));
+		assert(cn == co); // Same seed gives the same permutation
+		assert(cn != bj);
+		DynamicArray<int> cq(1 << 18); // Large enough to be merge shuffled across worker threads
+		cq.Fill();
+		for (size_t index = 0; index < cq.Size(); ++index)
+		{
+			cq[index] = static_cast<int>(index);
+		}
+		assert(cq.Shuffle(ExecutionPolicy::Parallel, cp)); // Merge shuffle of independently shuffled blocks
+		cq.Sort();
+		for (size_t index = 0; index < cq.Size(); ++index)
+		{
+			assert(cq[index] == static_cast<int>(index)); // Still a permutation
+		}
+		assert(!DynamicArray<int>{ 1 }.Shuffle(cp)); // Nothing to shuffle
+
+		// At method
+		DynamicArray<int> cr = { 1, 2, 3 };
+		assert(cr.At(0) == 1);
+		cr.At(2) = 4;
+		assert(cr[2] == 4);
+		bool success = false;
+		try
+		{
+			cr.At(3); // Invalid - always checked regardless of ARRAY_BOUNDS_CHECKING
+		}
+		catch (const std::out_of_range&)
+		{
+			success = true;
+		}
+		assert(success);
+
+		// Unchecked method
+		DynamicArray<int> cs = { 1, 2, 3 };
+		assert(cs.Unchecked(0) == 1);
+		cs.Unchecked(2) = 4;
+		assert(cs[2] == 4);
+
+		// Remove duplicates method (keeps first occurrences)
+		DynamicArray<int> ct = { 3, 1, 3, 2, 1, 3 };
+		assert(ct.RemoveDuplicates());
+		assert(ct == DynamicArray<int>({ 3, 1, 2 })); // First occurrences are kept in their original order
+		assert(!ct.RemoveDuplicates()); // No duplicates
+
+		DynamicArray<std::pair<int, int>> cu = { { 2, 1 }, { 1, 1 }, { 2, 1 }, { 1, 2 }, { 1, 1 } }; // Element type isn't hashable so is deduplicated by sorting
+		assert(cu.RemoveDuplicates());
+		assert(cu.Size() == 3);
+		assert(cu[0] == std::make_pair(2, 1));
+		assert(cu[1] == std::make_pair(1, 1));
+		assert(cu[2] == std::make_pair(1, 2));
+
+		// Sorted unique method
+		DynamicArray<int> cv = { 3, 1, 3, 2, 1, 3 };
+		assert(cv.SortedUnique());
+		assert(cv.Size() == 3);
+		assert(cv[0] == 1);
+		assert(cv[1] == 2);
+		assert(cv[2] == 3);
+		assert(!cv.SortedUnique()); // Already sorted with no duplicates
+
+		// Remove method (in place)
+		DynamicArray<int> cw = { 1, 2, 1, 3 };
+		cw.Remove(cw[0]); // Value can be an element of the array
+		assert(cw.Size() == 2);
+		assert(cw[0] == 2);
+		assert(cw[1] == 3);
+		assert(cw.Capacity() == 4); // Capacity is left unchanged
+		assert(!cw.Remove(4)); // Array doesn't contain value
+
+		DynamicArray<int8_t> cx(1000); // Large enough to be removed using vectorized instructions
+		DynamicArray<int64_t> cy(1000);
+		for (size_t i = 0; i < 1000; ++i)
+		{
+			cx.Add(static_cast<int8_t>(i % 3));
+			cy.Add(static_cast<int64_t>(i % 3));
+		}
+		assert(cx.Remove(int8_t{ 1 }));
+		assert(cy.Remove(int64_t{ 1 }));
+		assert(cx.Size() == 667);
+		assert(cy.Size() == 667);
+		for (size_t i = 0; i < 667; ++i)
+		{
+			assert(cx[i] == ((i % 2 == 0) ? 0 : 2)); // Remaining elements keep their order
+			assert(cy[i] == ((i % 2 == 0) ? 0 : 2));
+		}
+
+		// Remove if method
+		DynamicArray<int> cz = { 1, 2, 3, 4, 5, 6 };
+		assert(cz.RemoveIf([](const int& element) { return element % 2 == 0; }) == 3);
+		assert(cz.Size() == 3);
+		assert(cz[0] == 1);
+		assert(cz[1] == 3);
+		assert(cz[2] == 5);
+		assert(cz.RemoveIf([](const int& element) { return element > 5; }) == 0);
+
+		DynamicArray<std::string> da = { "a", "bd", "c", "dd" };
+		assert(da.RemoveIf([](const std::string& element) { return element.size() == 1; }) == 2);
+		assert(da.Size() == 2);
+		assert(da[0] == "bd");
+		assert(da[1] == "dd");
+
+		// Test struct that counts its live instances
+		struct Counted
+		{
+			Counted(int& count) : m_count(count) { ++m_count; }
+			Counted(const Counted& other) : m_count(other.m_count) { ++m_count; }
+			~Counted() { --m_count; }
+			Counted& operator=(const Counted&) { return *this; }
+
+			int& m_count;
+		};
+
+		// Emplace method (constructs elements in place within the capacity)
+		int db = 0;
+		{
+			DynamicArray<Counted> dc(8); // Element type can't be default constructed, and no elements are constructed for the capacity
+			assert(db == 0);
+			dc.Emplace(db);
+			dc.Emplace(db);
+			dc.EmplaceAt(1, db);
+			assert(db == 3);
+			dc.RemoveAt(0);
+			assert(db == 2);
+		}
+		assert(db == 0); // Elements are destroyed with the array
+
+		// Resize method (non-trivial elements)
+		DynamicArray<std::string> dd = { "a", "b", "c" };
+		dd.Resize(100); // Elements are moved into the new storage
+		assert(dd.Size() == 3);
+		assert(dd[2] == "c");
+		dd.Resize(2);
+		assert(dd.Size() == 2);
+		assert(dd[1] == "b");
+
+		DynamicArray<DynamicArray<int>> de; // Element type is trivially relocatable, so the storage is grown using realloc
+		for (int i = 0; i < 100; ++i)
+		{
+			de.Add(DynamicArray<int>({ i, i + 1 }));
+		}
+		de.Insert(0, DynamicArray<int>({ -1 }));
+		de.RemoveRange(1, 98);
+		assert(de.Size() == 3);
+		assert(de[0][0] == -1);
+		assert(de[1][0] == 98);
+		assert(de[2][1] == 100);
+		success = false;
+		try
+		{
+			de.Resize(std::numeric_limits<size_t>::max()); // Invalid - the size of the storage would overflow
+		}
+		catch (const std::bad_array_new_length&)
+		{
+			success = true;
+		}
+		assert(success);
+		assert(de.Size() == 3);
+
+		// Binary search methods (empty and reversed ranges)
+		DynamicArray<int> df = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+		assert(df.LowerBound(5, SortOrder::Ascending, 6, 3) == 6); // The start of the range is returned, as there are no elements to search
+		assert(df.LowerBound(5, SortOrder::Ascending, 4, 4) == 4);
+		assert(df.UpperBound(5, SortOrder::Ascending, 6, 3) == 6);
+		assert(df.EqualRange(5, SortOrder::Ascending, 6, 3).first == 6);
+		assert(df.EqualRange(5, SortOrder::Ascending, 6, 3).second == 6);
+		assert(df.BinarySearch(5, SortOrder::Ascending, 6, 3) == df.Size());
+		int dg[] = { 5, 8 };
+		size_t dh[2];
+		df.BatchLowerBound(dg, 2, dh, SortOrder::Ascending, 6, 3);
+		assert(dh[0] == 6);
+		assert(dh[1] == 6);
+		df.BatchUpperBound(dg, 2, dh, SortOrder::Ascending, 6, 3);
+		assert(dh[0] == 6);
+		assert(dh[1] == 6);
+
+		// Sort method (heap sort fallback)
+		// Note: The predicate only decides the order of elements as they are compared, always placing the pivot candidate below the rest, so every partition is unbalanced until the heap sort takes over.
+		DynamicArray<int> di(1000);
+		for (int i = 0; i < 1000; ++i)
+		{
+			di.Add(i);
+		}
+		std::vector<int> dj(1000, 1000); // Order of each element, where 1000 is undecided
+		int dk = 0; // Next order to decide
+		int dl = -1; // Pivot candidate
+		di.Sort([&](const int& a, const int& b)
+		{
+			if (dj[a] == 1000 && dj[b] == 1000)
+			{
+				dj[(a == dl) ? a : b] = dk++;
+			}
+			if (dj[a] == 1000)
+			{
+				dl = a;
+			}
+			else if (dj[b] == 1000)
+			{
+				dl = b;
+			}
+			return dj[a] < dj[b];
+		});
+		for (size_t i = 1; i < di.Size(); ++i)
+		{
+			assert(dj[di[i - 1]] < dj[di[i]]);
+		}
+
+		// Sort method (execution policy and sort order)
+		DynamicArray<int> dm(1000); // Sequential sorts of arithmetic types use the radix sort
+		dm.Fill();
+		for (int i = 0; i < 1000; ++i)
+		{
+			dm[i] = i * 7919 % 1000;
+		}
+		dm.Sort(ExecutionPolicy::Sequential, SortOrder::Descending);
+		for (size_t i = 1; i < dm.Size(); ++i)
+		{
+			assert(dm[i - 1] >= dm[i]);
+		}
+		dm.Sort(ExecutionPolicy::Parallel, SortOrder::Ascending, 0, dm.Size() - 1, 100);
+		for (size_t i = 1; i < dm.Size(); ++i)
+		{
+			assert(dm[i - 1] <= dm[i]);
+		}
+
+		DynamicArray<double> dn = { 1.0, std::numeric_limits<double>::quiet_NaN(), 3.0, 2.0 };
+		dn.Sort(ExecutionPolicy::Parallel, SortOrder::Descending);
+		assert(dn[0] == 3.0);
+		assert(dn[2] == 1.0);
+		assert(dn[3] != dn[3]); // NaNs are placed at the end of the range
 	}
 }
\ No newline at end of file
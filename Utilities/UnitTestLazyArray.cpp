@@ -0,0 +1,114 @@
+#include "UnitTestLazyArray.h"
+
+#include <cassert>
+
+#include "ArrayView.h"
+#include "DynamicArray.h"
+#include "LazyArray.h"
+#include "StaticArray.h"
+
+namespace UnitTests
+{
+	void UnitTestLazyArrayMethods();
+
+	void UnitTestLazyArray()
+	{
+		UnitTestLazyArrayMethods();
+	}
+
+	void UnitTestLazyArrayMethods()
+	{
+		// Collect method
+		StaticArray<int, 5> a = { 1, 2, 3, 4, 5 };
+		DynamicArray<int> b = a.Lazy().Collect(); // No stages, so the elements are copied
+		assert(b == a);
+
+		DynamicArray<int> c = a.Lazy(1, 4).Collect(); // Only the elements within the range are processed
+		assert(c.Size() == 3);
+		assert(c[0] == 2);
+		assert(c[2] == 4);
+
+		// Collect into method (Dynamic Array)
+		DynamicArray<int> d = { 1, 2, 3 };
+		DynamicArray<int> e = { 0 };
+		assert(d.Lazy().Map([](const int& element) { return element * 2; }).CollectInto(e) == 3);
+		assert(e.Size() == 4); // The results are added to the end
+		assert(e[0] == 0);
+		assert(e[1] == 2);
+		assert(e[3] == 6);
+
+		// Collect into method (other Array)
+		DynamicArray<int> f = { 1, 2, 3, 4, 5, 6 };
+		StaticArray<int, 4> g{};
+		assert(f.Lazy().Filter([](const int& element) { return element > 3; }).CollectInto(g) == 3);
+		assert(g[0] == 4);
+		assert(g[2] == 6);
+		assert(g[3] == 0); // Elements after the results are left unchanged
+
+		ArrayView<int> h = g.Slice(0, 2);
+		bool success = false;
+		try
+		{
+			f.Lazy().Map([](const int& element) { return element; }).CollectInto(h); // Invalid - destination array cannot be smaller than the results
+		}
+		catch (const std::length_error&)
+		{
+			success = true;
+		}
+		assert(success);
+
+		// Count method
+		StaticArray<int, 6> i = { 1, 2, 3, 4, 5, 6 };
+		assert(i.Lazy().Count() == 6);
+		assert(i.Lazy().Filter([](const int& element) { return element % 2 == 0; }).Count() == 3);
+
+		// Filter method
+		DynamicArray<int> j = { 1, 2, 3, 4, 5, 6 };
+		DynamicArray<int> k = j.Lazy().Filter([](const int& element) { return element % 2 == 0; }).Filter([](const int& element) { return element > 2; }).Collect();
+		assert(k.Size() == 2);
+		assert(k[0] == 4);
+		assert(k[1] == 6);
+
+		// For each method
+		StaticArray<int, 3> l = { 1, 2, 3 };
+		int m = 0;
+		l.Lazy().Map([](const int& element) { return element * element; }).ForEach([&](const int& element) { m += element; });
+		assert(m == 14);
+
+		// Map method
+		DynamicArray<int> n = { 1, 2, 3, 4 };
+		DynamicArray<double> o = n.Lazy().Filter([](const int& element) { return element != 2; }).Map([](const int& element) { return element * 0.5; }).Collect();
+		assert(o.Size() == 3);
+		assert(o[0] == 0.5);
+		assert(o[1] == 1.5);
+		assert(o[2] == 2.0);
+
+		// Take method
+		DynamicArray<int> p = { 1, 2, 3, 4, 5, 6, 7, 8 };
+		auto q = p.Lazy().Filter([](const int& element) { return element % 2 == 1; }).Take(3);
+		assert(q.Count() == 3);
+		DynamicArray<int> r = q.Collect(); // The pipeline can be run again, as the number taken starts afresh
+		assert(r.Size() == 3);
+		assert(r[0] == 1);
+		assert(r[2] == 5);
+		assert(p.Lazy().Take(2).Map([](const int& element) { return element * 10; }).Collect() == DynamicArray<int>({ 10, 20 }));
+		assert(p.Lazy().Filter([](const int& element) { return element > 2; }).Take(0).Count() == 0);
+
+		// Parallel execution
+		DynamicArray<int> s(1 << 20); // Large enough to be split across worker threads
+		s.Fill(ExecutionPolicy::Parallel, 1);
+		s[0] = 2;
+		s[(1 << 20) - 1] = 3;
+		auto t = s.Lazy().Filter([](const int& element) { return element > 1; });
+		assert(t.Count(ExecutionPolicy::Parallel) == 2);
+		DynamicArray<int> u = t.Collect(ExecutionPolicy::Parallel);
+		assert(u.Size() == 2);
+		assert(u[0] == 2); // The results are in order
+		assert(u[1] == 3);
+		DynamicArray<int> v = s.Lazy().Map([](const int& element) { return element * 2; }).Collect(ExecutionPolicy::ParallelUnsequenced);
+		assert(v.Size() == s.Size());
+		assert(v[0] == 4);
+		assert(v[1] == 2);
+		assert(v[(1 << 20) - 1] == 6);
+	}
+}
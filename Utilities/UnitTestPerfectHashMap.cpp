@@ -0,0 +1,195 @@
+#include "UnitTestPerfectHashMap.h"
+
+#include <cassert>
+#include <string>
+#include <string_view>
+
+#include "PerfectHashMap.h"
+#include "Random.h"
+#include "StaticArray.h"
+
+namespace UnitTests
+{
+	void UnitTestPerfectHashSet();
+	void UnitTestPerfectHashMapMethods();
+	void UnitTestPerfectHashMapComposition();
+
+	enum class Colour { Red, Green, Blue };
+
+	void UnitTestPerfectHashMap()
+	{
+		UnitTestPerfectHashSet();
+		UnitTestPerfectHashMapMethods();
+		UnitTestPerfectHashMapComposition();
+	}
+
+	void UnitTestPerfectHashSet()
+	{
+		// Conversion constructor from Static Array (constexpr)
+		constexpr StaticArray<std::string_view, 8> a = { "if", "else", "for", "while", "do", "switch", "case", "return" };
+		constexpr PerfectHashSet b(a);
+		static_assert(b.Size() == 8);
+
+		// Contains method (constexpr)
+		static_assert(b.Contains("while"));
+		static_assert(b.Contains("return"));
+		static_assert(!b.Contains("goto"));
+		static_assert(!b.Contains(""));
+
+		// Index of method - every key has its own slot
+		for (const std::string_view& key : a)
+		{
+			const size_t index = b.IndexOf(key);
+			assert(index < b.Size());
+			assert(b.Keys()[index] == key);
+		}
+		assert(b.IndexOf("whilst") == b.Size());
+
+		// Contains method with a runtime string
+		const std::string c = "switch";
+		assert(b.Contains(c));
+		assert(!b.Contains(c + "es"));
+
+		// Integer keys
+		constexpr PerfectHashSet d(StaticArray<int, 6>{ -3, 0, 7, 42, 1000000, -2147483647 - 1 });
+		static_assert(d.Contains(-2147483647 - 1));
+		static_assert(d.Contains(0));
+		static_assert(!d.Contains(1));
+
+		// Enum keys
+		constexpr PerfectHashSet e(StaticArray<Colour, 2>{ Colour::Red, Colour::Blue });
+		static_assert(e.Contains(Colour::Blue));
+		static_assert(!e.Contains(Colour::Green));
+
+		// Large key sets
+		StaticArray<uint64_t, 1000> f;
+		Random g(42);
+		for (uint64_t& key : f)
+		{
+			key = g();
+		}
+		const PerfectHashSet h(f);
+		for (const uint64_t key : f)
+		{
+			assert(h.Keys()[h.IndexOf(key)] == key);
+		}
+		for (size_t i = 0; i < 1000; ++i)
+		{
+			assert(!h.Contains(g()));
+		}
+
+		// Duplicate keys
+		bool success = false;
+		try
+		{
+			PerfectHashSet i(StaticArray<int, 3>{ 1, 2, 1 }); // Invalid - keys must be unique
+		}
+		catch (const std::invalid_argument&)
+		{
+			success = true;
+		}
+		assert(success);
+
+		// C-style string keys are compared by their contents, as they are hashed by them
+		constexpr PerfectHashSet<const char*, 3> j(StaticArray<const char*, 3>{ "red", "green", "blue" });
+		const char k[] = { 'g', 'r', 'e', 'e', 'n', '\0' };
+		assert(j.Contains(k));
+		assert(j.Keys()[j.IndexOf(k)] != k);
+		assert(!j.Contains("gree"));
+		static_assert(j == PerfectHashSet<const char*, 3>(StaticArray<const char*, 3>{ "blue", "red", "green" }));
+	}
+
+	void UnitTestPerfectHashMapMethods()
+	{
+		// Conversion constructor from Static Arrays (constexpr)
+		constexpr PerfectHashMap a(StaticArray<std::string_view, 4>{ "one", "two", "three", "four" }, StaticArray<int, 4>{ 1, 2, 3, 4 });
+		static_assert(a.Size() == 4);
+
+		// At method (constexpr)
+		static_assert(a.At("one") == 1);
+		static_assert(a.At("three") == 3);
+		static_assert(a.At("four") == 4);
+
+		bool success = false;
+		try
+		{
+			a.At("five"); // Invalid - key not found
+		}
+		catch (const std::out_of_range&)
+		{
+			success = true;
+		}
+		assert(success);
+
+		// Find method
+		const int* b = a.Find("two");
+		assert(b != nullptr && *b == 2);
+		assert(a.Find("zero") == nullptr);
+
+		// Contains method
+		static_assert(a.Contains("two"));
+		static_assert(!a.Contains("twenty"));
+
+		// Index of method - the values are stored in the same slots as their keys
+		static_assert(a.Values()[a.IndexOf("three")] == 3);
+		assert(a.Keys()[a.IndexOf("four")] == "four");
+		assert(a.IndexOf("six") == a.Size());
+	}
+
+	void UnitTestPerfectHashMapComposition()
+	{
+		// Equality operator - the table only depends on the set of keys
+		constexpr PerfectHashSet a(StaticArray<int, 5>{ 1, 2, 3, 4, 5 });
+		constexpr PerfectHashSet b(StaticArray<int, 5>{ 5, 3, 1, 4, 2 });
+		static_assert(a == b);
+		static_assert(a.Keys() == b.Keys());
+
+		// Inequality operator
+		constexpr PerfectHashSet c(StaticArray<int, 5>{ 1, 2, 3, 4, 6 });
+		constexpr PerfectHashSet d(StaticArray<int, 4>{ 1, 2, 3, 4 });
+		static_assert(a != c);
+		static_assert(a != d);
+
+		// Addition operator - concatenates two Perfect Hash Sets
+		constexpr PerfectHashSet e(StaticArray<int, 3>{ 10, 20, 30 });
+		constexpr PerfectHashSet<int, 8> f = a + e;
+		static_assert(f.Contains(3));
+		static_assert(f.Contains(30));
+		static_assert(!f.Contains(6));
+		static_assert(f == PerfectHashSet(StaticArray<int, 8>{ 30, 20, 10, 5, 4, 3, 2, 1 }));
+
+		// Addition operator - concatenates a Perfect Hash Set and a Static Array
+		constexpr PerfectHashSet<int, 10> g = f + StaticArray<int, 2>{ 40, 50 };
+		static_assert(g.Contains(50));
+		static_assert(g == a + e + StaticArray<int, 2>{ 40, 50 });
+
+		// Keys method - the keys can be concatenated and compared as Static Arrays
+		constexpr StaticArray<int, 13> h = g.Keys() + StaticArray<int, 3>{ 60, 70, 80 };
+		static_assert(PerfectHashSet(h).Contains(80));
+		static_assert(PerfectHashSet(h) == g + StaticArray<int, 3>{ 80, 70, 60 });
+
+		// Addition operator - concatenates two Perfect Hash Maps
+		constexpr PerfectHashMap i(StaticArray<std::string_view, 2>{ "red", "green" }, StaticArray<Colour, 2>{ Colour::Red, Colour::Green });
+		constexpr PerfectHashMap j(StaticArray<std::string_view, 1>{ "blue" }, StaticArray<Colour, 1>{ Colour::Blue });
+		constexpr PerfectHashMap<std::string_view, Colour, 3> k = i + j;
+		static_assert(k.At("red") == Colour::Red);
+		static_assert(k.At("blue") == Colour::Blue);
+
+		// Equality operator for maps
+		static_assert(k == PerfectHashMap(StaticArray<std::string_view, 3>{ "blue", "green", "red" }, StaticArray<Colour, 3>{ Colour::Blue, Colour::Green, Colour::Red }));
+		static_assert(k != PerfectHashMap(StaticArray<std::string_view, 3>{ "blue", "green", "red" }, StaticArray<Colour, 3>{ Colour::Red, Colour::Green, Colour::Blue }));
+		static_assert(i != k);
+
+		// Duplicate keys across the composed maps
+		bool success = false;
+		try
+		{
+			const PerfectHashMap<std::string_view, Colour, 4> l = k + j; // Invalid - keys must be unique
+		}
+		catch (const std::invalid_argument&)
+		{
+			success = true;
+		}
+		assert(success);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include "UnitTestSimd.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "DynamicArray.h"
+#include "Simd.h"
+
+namespace UnitTests
+{
+	template<typename T>
+	void UnitTestSimdSearch();
+
+	void UnitTestSimd()
+	{
+		UnitTestSimdSearch<int8_t>();
+		UnitTestSimdSearch<uint8_t>();
+		UnitTestSimdSearch<int16_t>();
+		UnitTestSimdSearch<uint16_t>();
+		UnitTestSimdSearch<int32_t>();
+		UnitTestSimdSearch<uint32_t>();
+		UnitTestSimdSearch<int64_t>();
+		UnitTestSimdSearch<float>();
+		UnitTestSimdSearch<double>();
+	}
+
+	template<typename T>
+	void UnitTestSimdSearch()
+	{
+		// Sizes that aren't a multiple of the lanes of any register, from the scalar tail alone up to many registers
+		// Note: The largest sizes are needed for Count to sum its per-byte counters more than once (255 registers).
+		const size_t a[] = { 0, 1, 3, 7, 15, 17, 31, 33, 63, 65, 127, 129, 257, 1001, 4099, 8191, 16411, 65537 };
+		for (const size_t size : a)
+		{
+			std::vector<T> b(size);
+			for (size_t i = 0; i < size; ++i)
+			{
+				b[i] = static_cast<T>(i % 7);
+			}
+
+			// Count method
+			for (int value = 0; value < 8; ++value)
+			{
+				const T c = static_cast<T>(value);
+				assert(Simd::Count(b.data(), size, c) == static_cast<size_t>(std::count(b.begin(), b.end(), c)));
+			}
+
+			// Indexof method
+			const T d = static_cast<T>(6);
+			const size_t e = static_cast<size_t>(std::find(b.begin(), b.end(), d) - b.begin());
+			assert(Simd::IndexOf(b.data(), size, d) == e);
+			assert(Simd::IndexOf(b.data(), size, static_cast<T>(7)) == size); // Not found
+
+			// Reverse indexof method
+			const size_t f = (e == size) ? size : size - 1 - static_cast<size_t>(std::find(b.rbegin(), b.rend(), d) - b.rbegin());
+			assert(Simd::ReverseIndexOf(b.data(), size, d) == f);
+			assert(Simd::ReverseIndexOf(b.data(), size, static_cast<T>(7)) == size); // Not found
+
+			// A single match at the start, on either side of register boundaries and in the tail
+			const T g = static_cast<T>(100);
+			const size_t h[] = { 0, 1, 7, 8, 15, 16, 31, 32, 63, 64, size / 2, size - 2, size - 1 };
+			for (const size_t index : h)
+			{
+				if (index >= size)
+				{
+					continue;
+				}
+
+				const T previous = b[index];
+				b[index] = g;
+				assert(Simd::Count(b.data(), size, g) == 1);
+				assert(Simd::IndexOf(b.data(), size, g) == index);
+				assert(Simd::ReverseIndexOf(b.data(), size, g) == index);
+				b[index] = previous;
+			}
+
+			// Unaligned data
+			if (size > 1)
+			{
+				b[size - 1] = g;
+				assert(Simd::Count(b.data() + 1, size - 1, g) == 1);
+				assert(Simd::IndexOf(b.data() + 1, size - 1, g) == size - 2);
+				assert(Simd::ReverseIndexOf(b.data() + 1, size - 1, g) == size - 2);
+				b[size - 1] = static_cast<T>((size - 1) % 7);
+			}
+
+			// Every element matches, so every byte counter is incremented in each register
+			std::vector<T> j(size, g);
+			assert(Simd::Count(j.data(), size, g) == size);
+			assert(Simd::IndexOf(j.data(), size, g) == 0);
+			assert(Simd::ReverseIndexOf(j.data(), size, g) == ((size > 0) ? size - 1 : size));
+
+			// Contains method (searches using the vectorized index of)
+			DynamicArray<T> k(b.data(), size);
+			assert(k.Contains(static_cast<T>(0)) == (size > 0));
+			assert(!k.Contains(g));
+			assert(k.Count(static_cast<T>(1)) == static_cast<size_t>(std::count(b.begin(), b.end(), static_cast<T>(1))));
+
+			if constexpr (std::is_floating_point_v<T>)
+			{
+				// NaN is never equal, and 0.0 equals -0.0
+				std::vector<T> l(size, std::numeric_limits<T>::quiet_NaN());
+				assert(Simd::Count(l.data(), size, std::numeric_limits<T>::quiet_NaN()) == 0);
+				assert(Simd::IndexOf(l.data(), size, std::numeric_limits<T>::quiet_NaN()) == size);
+				assert(Simd::ReverseIndexOf(l.data(), size, std::numeric_limits<T>::quiet_NaN()) == size);
+				std::fill(l.begin(), l.end(), static_cast<T>(-0.0));
+				assert(Simd::Count(l.data(), size, static_cast<T>(0.0)) == size);
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,221 @@
+#include "UnitTestSmallArray.h"
+
+#include <cassert>
+#include <string>
+
+#include "SmallArray.h"
+#include "StaticArray.h"
+
+namespace UnitTests
+{
+	void UnitTestSmallArrayConstructors();
+	void UnitTestSmallArrayAssignment();
+	void UnitTestSmallArrayMethods();
+
+	// Returns whether the elements of the Small Array are stored inside it
+	template<typename T, size_t N>
+	bool IsInline(const SmallArray<T, N>& array)
+	{
+		const char* begin = reinterpret_cast<const char*>(&array);
+		const char* data = reinterpret_cast<const char*>(array.Data());
+		return data >= begin && data < begin + sizeof(array);
+	}
+
+	void UnitTestSmallArray()
+	{
+		UnitTestSmallArrayConstructors();
+		UnitTestSmallArrayAssignment();
+		UnitTestSmallArrayMethods();
+	}
+
+	void UnitTestSmallArrayConstructors()
+	{
+		// Default constructor
+		SmallArray<int, 4> a;
+		assert(a.Size() == 0);
+		assert(a.Capacity() == 4); // The inline storage is always available
+		assert(IsInline(a));
+
+		// Constructor with capacity argument
+		SmallArray<int, 4> b(2);
+		assert(b.Capacity() == 4);
+		assert(IsInline(b));
+
+		SmallArray<int, 4> c(8); // Larger than the inline storage, so it is allocated
+		assert(c.Capacity() == 8);
+		assert(!IsInline(c));
+
+		// Conversion copy constructor from initializer list
+		SmallArray<int, 4> d = { 1, 2, 3 };
+		assert(d.Size() == 3);
+		assert(d[2] == 3);
+		assert(IsInline(d));
+
+		// Copy constructor
+		SmallArray<int, 4> e = d;
+		assert(e == d);
+		assert(IsInline(e));
+		assert(e.Data() != d.Data());
+
+		// Move constructor (inline) - the elements are moved, as the storage can't be taken
+		SmallArray<std::string, 2> f = { "a", "b" };
+		SmallArray<std::string, 2> g = std::move(f);
+		assert(g.Size() == 2);
+		assert(g[1] == "b");
+		assert(IsInline(g));
+		assert(f.Size() == 0);
+		assert(IsInline(f));
+
+		// Move constructor (allocated) - the storage is taken
+		SmallArray<std::string, 2> h = { "a", "b", "c" };
+		const std::string* i = h.Data();
+		SmallArray<std::string, 2> j = std::move(h);
+		assert(j.Data() == i);
+		assert(j.Size() == 3);
+		assert(h.Size() == 0);
+		assert(h.Capacity() == 2); // The other array goes back to its inline storage
+		assert(IsInline(h));
+
+		// Conversion copy constructor from other Array
+		StaticArray<int, 3> k = { 1, 2, 3 };
+		SmallArray<int, 4> l = k;
+		assert(l == k);
+
+		// Adapter to the runtime Array interface
+		ArrayAdapter m(l);
+		Array<int>& n = m;
+		assert(n.Size() == 3);
+		assert(n[2] == 3);
+	}
+
+	void UnitTestSmallArrayAssignment()
+	{
+		// Copy assignment operator
+		SmallArray<int, 4> a = { 1, 2, 3 };
+		SmallArray<int, 4> b;
+		b = a;
+		assert(b == a);
+		assert(IsInline(b));
+
+		SmallArray<int, 4> c = { 1, 2, 3, 4, 5 };
+		b = c; // Grows past the inline storage
+		assert(b == c);
+		assert(!IsInline(b));
+
+		// Move assignment operator (inline)
+		SmallArray<std::string, 2> d = { "a" };
+		SmallArray<std::string, 2> e = { "b", "c", "d" };
+		e = std::move(d); // The elements are moved into the existing storage
+		assert(e.Size() == 1);
+		assert(e[0] == "a");
+		assert(d.Size() == 0);
+
+		// Move assignment operator (allocated)
+		SmallArray<std::string, 2> f = { "a", "b", "c" };
+		const std::string* g = f.Data();
+		SmallArray<std::string, 2> h = { "d" };
+		h = std::move(f);
+		assert(h.Data() == g);
+		assert(h.Size() == 3);
+		assert(f.Size() == 0);
+		assert(IsInline(f));
+
+		// Conversion copy assignment operator from c-style array
+		SmallArray<int, 4> i;
+		i = { 4, 5 };
+		assert(i.Size() == 2);
+		assert(i[1] == 5);
+		assert(IsInline(i));
+	}
+
+	void UnitTestSmallArrayMethods()
+	{
+		// Add method
+		SmallArray<int, 4> a;
+		for (int i = 0; i < 4; ++i)
+		{
+			a.Add(i);
+		}
+		assert(IsInline(a));
+
+		a.Add(4); // Grows past the inline storage
+		assert(!IsInline(a));
+		assert(a.Size() == 5);
+		assert(a.Capacity() == 8);
+		for (int i = 0; i < 5; ++i)
+		{
+			assert(a[i] == i);
+		}
+
+		// Insert method
+		a.Insert(0, -1);
+		assert(a.Size() == 6);
+		assert(a[0] == -1);
+		assert(a[5] == 4);
+
+		// RemoveRange method
+		a.RemoveRange(0, 3); // Shrinks back into the inline storage
+		assert(a.Size() == 2);
+		assert(a[0] == 3);
+		assert(a[1] == 4);
+		assert(IsInline(a));
+		assert(a.Capacity() == 4);
+
+		// Remove method
+		SmallArray<int, 8> b = { 1, 2, 1, 3, 1 };
+		assert(b.Remove(1));
+		assert(b.Size() == 2);
+		assert(b[0] == 2);
+		assert(b[1] == 3);
+
+		// RemoveAll method
+		SmallArray<std::string, 2> c = { "a", "b" };
+		assert(c.RemoveAll()); // The elements are destroyed even though the capacity doesn't change
+		assert(c.Size() == 0);
+		assert(c.Capacity() == 2);
+		assert(!c.RemoveAll());
+
+		SmallArray<int, 2> d = { 1, 2, 3 };
+		assert(d.RemoveAll()); // Moves back into the inline storage without keeping any elements
+		assert(d.Size() == 0);
+		assert(d.Capacity() == 2);
+
+		// Trim method
+		SmallArray<int, 4> e = { 1, 2, 3, 4, 5 };
+		e.RemoveAt(4);
+		assert(e.Trim());
+		assert(IsInline(e));
+		assert(e.Size() == 4);
+		assert(e[3] == 4);
+
+		// Sort method (Array algorithms)
+		SmallArray<int, 4> f = { 3, 1, 2 };
+		f.Sort();
+		assert(f[0] == 1);
+		assert(f[2] == 3);
+		assert(f.Contains(2));
+		assert(f.IndexOf(3) == 2);
+
+		// Non-trivial elements
+		SmallArray<std::string, 2> g;
+		g.Add(std::string(100, 'a'));
+		g.Add("b");
+		g.Insert(0, "c"); // Moved out of the inline storage
+		assert(g.Size() == 3);
+		assert(g[0] == "c");
+		assert(g[1].size() == 100);
+		g.RemoveRange(0, 1);
+		assert(g.Size() == 1);
+		assert(g[0] == "b");
+		assert(IsInline(g));
+
+		// Nested Small Arrays, which must be moved rather than relocated as they point into themselves
+		DynamicArray<SmallArray<int, 2>> h;
+		for (int i = 0; i < 10; ++i)
+		{
+			h.Add(SmallArray<int, 2>({ i, i }));
+		}
+		assert(h[9][1] == 9);
+		assert(IsInline(h[9]));
+	}
+}
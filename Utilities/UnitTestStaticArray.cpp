@@ -2,9 +2,10 @@
 
 #include <array>
 #include <cassert>
-#include <ctime>
+#include <type_traits>
 
 #include "DynamicArray.h"
+#include "Random.h"
 #include "StaticArray.h"
 
 namespace UnitTests
@@ -14,6 +15,7 @@ namespace UnitTests
 	void UnitTestStaticArrayOperators();
 	void UnitTestStaticArrayMethods();
 	void UnitTestStaticArrayZero();
+	void UnitTestStaticArrayConstexpr();
 
 	void UnitTestStaticArray()
 	{
@@ -22,6 +24,7 @@ namespace UnitTests
 		UnitTestStaticArrayOperators();
 		UnitTestStaticArrayMethods();
 		UnitTestStaticArrayZero();
+		UnitTestStaticArrayConstexpr();
 	}
 
 	void UnitTestStaticArrayConstructors()
@@ -232,6 +235,20 @@ namespace UnitTests
 		assert(v[2] == 3);
 		assert(v[3] == 0);
 		assert(v[4] == 0);
+
+		// Adapter to the runtime Array interface
+		StaticArray<int, 3> w = { 1, 2, 3 };
+		ArrayAdapter x(w);
+		Array<int>& y = x;
+		assert(y.Size() == 3);
+		assert(y[2] == 3);
+		assert(y == w);
+		y[0] = 4;
+		assert(w[0] == 4);
+		assert(y.Sort());
+		assert(w[0] == 2);
+		StaticArray<int, 3> z = y;
+		assert(z == w);
 	}
 
 	void UnitTestStaticArrayAssignment()
@@ -679,25 +696,26 @@ namespace UnitTests
 		// Reverse indexof method
 		StaticArray<int, 4> ah = { 1, 2, 2, 3 };
 		assert(ah.ReverseIndexOf(2) == 2);
+		assert(ah.ReverseIndexOf(1) == 0);
 		assert(ah.ReverseIndexOf(4) == ah.Size());
 		assert(ah.ReverseIndexOf([](const int& element) { return element < 3; }) == 2);
+		assert(ah.ReverseIndexOf([](const int& element) { return element < 2; }) == 0);
 
 		// Shuffle method
 		StaticArray<int, 10> ai = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
-		srand(static_cast<unsigned int>(time(nullptr))); // Seed random number generator
 		ai.Shuffle();
 		StaticArray<int, 10> aj = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
 		assert(ai != aj); // This may still assert due to the nature of randomness but would be extremely unlikely
 
 		// Sort method
 		StaticArray<int, 3> ak = { 3, 1, 2 };
-		ak.Sort(); // Insertion sort < 10 elements
+		ak.Sort(); // Sorting network <= 32 elements
 		assert(ak[0] == 1);
 		assert(ak[1] == 2);
 		assert(ak[2] == 3);
 
 		StaticArray<int, 10> al = { 3, 1, 2, 7, 10, 9, 6, 8, 5, 4 };
-		al.Sort(); // Quick sort >= 10 elements
+		al.Sort(); // Sorting network <= 32 elements
 		assert(al[0] == 1);
 		assert(al[1] == 2);
 		assert(al[2] == 3);
@@ -709,6 +727,15 @@ namespace UnitTests
 		assert(al[8] == 9);
 		assert(al[9] == 10);
 
+		al.Sort(SortOrder::Descending);
+		assert(al[0] == 10);
+		assert(al[9] == 1);
+
+		al.Sort(SortOrder::Ascending, 0, 4); // Sub-ranges are sorted using the insertion sort or quick sort instead
+		assert(al[0] == 6);
+		assert(al[4] == 10);
+		assert(al[5] == 5);
+
 		StaticArray<int, 3> am = { 1, 2, 3 };
 		am.Sort([](const int& left, const int& right) { return left % 2 == 1 && right % 2 == 0; });
 		assert(am[0] == 1);
@@ -721,6 +748,171 @@ namespace UnitTests
 		assert(an[0] == 3);
 		assert(an[1] == 2);
 		assert(an[2] == 1);
+
+		// Stable sort method
+		StaticArray<int, 9> ao = { 31, 12, 22, 11, 32, 21, 13, 33, 23 };
+		ao.StableSort([](const int& left, const int& right) { return left / 10 < right / 10; }); // Equal elements keep their relative order
+		assert(ao[0] == 12);
+		assert(ao[1] == 11);
+		assert(ao[2] == 13);
+		assert(ao[3] == 22);
+		assert(ao[4] == 21);
+		assert(ao[5] == 23);
+		assert(ao[6] == 31);
+		assert(ao[7] == 32);
+		assert(ao[8] == 33);
+
+		// Nth element method
+		StaticArray<int, 12> ap = { 3, 1, 2, 7, 10, 9, 6, 8, 5, 4, 11, 12 };
+		ap.NthElement(4);
+		assert(ap[4] == 5);
+		for (size_t i = 0; i < 4; ++i)
+		{
+			assert(ap[i] < 5);
+		}
+		for (size_t i = 5; i < ap.Size(); ++i)
+		{
+			assert(ap[i] > 5);
+		}
+		ap.NthElement(0, SortOrder::Descending);
+		assert(ap[0] == 12);
+
+		// Partial sort method
+		StaticArray<int, 12> aq = { 3, 1, 2, 7, 10, 9, 6, 8, 5, 4, 11, 12 };
+		aq.PartialSort(3);
+		assert(aq[0] == 1);
+		assert(aq[1] == 2);
+		assert(aq[2] == 3);
+		aq.PartialSort(2, [](const int& a, const int& b) { return a > b; });
+		assert(aq[0] == 12);
+		assert(aq[1] == 11);
+
+		// Top k method
+		StaticArray<int, 12> ar = { 3, 1, 2, 7, 10, 9, 6, 8, 5, 4, 11, 12 };
+		DynamicArray<int> as = ar.TopK(3);
+		assert(as.Size() == 3);
+		assert(as[0] == 12);
+		assert(as[1] == 11);
+		assert(as[2] == 10);
+		assert(ar[0] == 3); // Source array is left unchanged
+		as = ar.TopK(2, SortOrder::Ascending);
+		assert(as[0] == 1);
+		assert(as[1] == 2);
+		assert(ar.TopK(20).Size() == ar.Size());
+
+		// Batch lower bound method
+		StaticArray<int, 6> at = { 1, 2, 2, 2, 3, 5 };
+		int au[] = { 2, 0, 4, 6 };
+		size_t av[4];
+		at.BatchLowerBound(au, 4, av);
+		assert(av[0] == 1);
+		assert(av[1] == 0);
+		assert(av[2] == 5);
+		assert(av[3] == 6);
+
+		// Batch upper bound method
+		at.BatchUpperBound(au, 4, av);
+		assert(av[0] == 4);
+		assert(av[1] == 0);
+		assert(av[2] == 5);
+		assert(av[3] == 6);
+
+		// Binary search method
+		assert(at.BinarySearch(2) == 1);
+		assert(at.BinarySearch(4) == at.Size());
+		StaticArray<int, 5> aw = { 5, 3, 2, 2, 1 };
+		assert(aw.BinarySearch(2, SortOrder::Descending) == 2);
+		assert(aw.BinarySearch(3, [](const int& a, const int& b) { return a > b; }) == 1);
+
+		// Equal range method
+		StaticArray<int, 6> ax = { 1, 2, 2, 2, 3, 5 };
+		assert(ax.EqualRange(2).first == 1);
+		assert(ax.EqualRange(2).second == 4);
+		assert(ax.EqualRange(4).first == ax.EqualRange(4).second);
+
+		// Lower bound method
+		StaticArray<int, 6> ay = { 1, 2, 2, 2, 3, 5 };
+		assert(ay.LowerBound(2) == 1);
+		assert(ay.LowerBound(4) == 5);
+		assert(ay.LowerBound(6) == ay.Size());
+		assert(ay.LowerBound(2, SortOrder::Ascending, 2) == 2);
+
+		// Upper bound method
+		StaticArray<int, 6> az = { 1, 2, 2, 2, 3, 5 };
+		assert(az.UpperBound(2) == 4);
+		assert(az.UpperBound(0) == 0);
+		assert(az.UpperBound(5) == az.Size());
+		assert(az.UpperBound(2, SortOrder::Ascending, 0, 3) == 3);
+
+		// Count method (execution policy)
+		StaticArray<int, 5> ba = { 1, 2, 2, 2, 3 };
+		assert(ba.Count(ExecutionPolicy::Parallel, 2) == 3);
+		assert(ba.Count(ExecutionPolicy::ParallelUnsequenced, [](const int& element) { return element % 2 == 1; }) == 2);
+
+		StaticArray<int*, 3> bb{};
+		assert(bb.Count(ExecutionPolicy::Parallel, nullptr) == 3);
+
+		// Fill method (execution policy)
+		StaticArray<int, 3> bc;
+		bc.Fill(ExecutionPolicy::Parallel, 3);
+		assert(bc[0] == 3);
+		assert(bc[1] == 3);
+		assert(bc[2] == 3);
+
+		// Find method (execution policy)
+		StaticArray<int, 3> bd = { 1, 2, 3 };
+		assert(bd.Find(ExecutionPolicy::Parallel, [](const int& element) { return element > 1; }) == &bd[1]);
+		assert(!bd.Find(ExecutionPolicy::ParallelUnsequenced, [](const int& element) { return element > 3; }));
+
+		// Indexof method (execution policy)
+		StaticArray<int, 3> be = { 1, 2, 3 };
+		assert(be.IndexOf(ExecutionPolicy::Parallel, 2) == 1);
+		assert(be.IndexOf(ExecutionPolicy::ParallelUnsequenced, [](const int& element) { return element > 2; }) == 2);
+
+		// Replace method (execution policy)
+		StaticArray<int, 3> bf = { 1, 2, 3 };
+		bf.Replace(ExecutionPolicy::Parallel, 2, 4);
+		assert(bf[0] == 1);
+		assert(bf[1] == 4);
+		assert(bf[2] == 3);
+		bf.Replace(ExecutionPolicy::ParallelUnsequenced, [](const int& element) { return element % 2 == 1; }, 6);
+		assert(bf[0] == 6);
+		assert(bf[1] == 4);
+		assert(bf[2] == 6);
+
+		// Shuffle method (random engine)
+		StaticArray<int, 10> bg = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+		StaticArray<int, 10> bh = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+		Random bi(42);
+		assert(bg.Shuffle(bi));
+		bi.Seed(42);
+		assert(bh.Shuffle(bi));
+		assert(bg == bh); // Same seed gives the same permutation
+		assert(bg != aj);
+		assert(bg.Shuffle(ExecutionPolicy::Parallel, bi)); // Small arrays fall back to a sequential shuffle
+		assert(!(StaticArray<int, 1>{ 1 }).Shuffle(bi)); // Nothing to shuffle
+
+		// At method
+		StaticArray<int, 3> bj = { 1, 2, 3 };
+		assert(bj.At(0) == 1);
+		bj.At(2) = 4;
+		assert(bj[2] == 4);
+		success = false;
+		try
+		{
+			bj.At(3); // Invalid - always checked regardless of ARRAY_BOUNDS_CHECKING
+		}
+		catch (const std::out_of_range&)
+		{
+			success = true;
+		}
+		assert(success);
+
+		// Unchecked method
+		StaticArray<int, 3> bk = { 1, 2, 3 };
+		assert(bk.Unchecked(0) == 1);
+		bk.Unchecked(2) = 4;
+		assert(bk[2] == 4);
 	}
 
 	void UnitTestStaticArrayZero()
@@ -852,4 +1044,92 @@ namespace UnitTests
 		assert(t[1] == 0);
 		assert(t[2] == 0);
 	}
+
+	// Returns a sorted copy of the array
+	template <typename T, size_t N, typename Order>
+	constexpr StaticArray<T, N> Sorted(StaticArray<T, N> array, const Order& order)
+	{
+		array.Sort(order);
+		return array;
+	}
+
+	// Returns a reversed copy of the array
+	template <typename T, size_t N>
+	constexpr StaticArray<T, N> Reversed(StaticArray<T, N> array)
+	{
+		array.Reverse();
+		return array;
+	}
+
+	// Returns the sum of the elements of the array passed as a template argument
+	template <StaticArray<int, 3> Array>
+	constexpr int Sum()
+	{
+		int sum = 0;
+		for (const int& element : Array)
+		{
+			sum += element;
+		}
+		return sum;
+	}
+
+	void UnitTestStaticArrayConstexpr()
+	{
+		// Trivially copyable with no virtual table
+		static_assert(std::is_trivially_copyable_v<StaticArray<int, 4>>);
+		static_assert(sizeof(StaticArray<int, 4>) == sizeof(int[4]));
+
+		// Structural type usable as a template argument
+		static_assert(Sum<StaticArray<int, 3>{ 1, 2, 3 }>() == 6);
+
+		// Sort method
+		constexpr StaticArray<int, 5> a = Sorted(StaticArray<int, 5>{ 4, 2, 5, 1, 3 }, SortOrder::Ascending);
+		static_assert(a[0] == 1);
+		static_assert(a[2] == 3);
+		static_assert(a[4] == 5);
+
+		// Sort method with predicate (large enough to skip the sorting network)
+		constexpr StaticArray<int, 40> b = Sorted(StaticArray<int, 40>{ 7, 3, 9, 1, 5 }, [](const int& left, const int& right) { return left > right; });
+		static_assert(b[0] == 9);
+		static_assert(b[4] == 1);
+		static_assert(b[39] == 0);
+
+		// Reverse method
+		constexpr StaticArray<int, 5> c = Reversed(a);
+		static_assert(c[0] == 5);
+		static_assert(c[4] == 1);
+
+		// Equality operators
+		static_assert(Reversed(c) == a);
+		static_assert(c != a);
+		constexpr int d[] = { 1, 2, 3, 4, 5 };
+		static_assert(a == d);
+
+		// Index of method
+		static_assert(a.IndexOf(3) == 2);
+		static_assert(a.IndexOf(6) == a.Size());
+		static_assert(a.IndexOf([](const int& element) { return element > 3; }) == 3);
+
+		// Contains method
+		static_assert(a.Contains(5));
+		static_assert(!a.Contains(0));
+
+		// Addition operators
+		constexpr StaticArray<int, 10> e = a + c;
+		static_assert(e[4] == 5);
+		static_assert(e[5] == 5);
+		static_assert(e[9] == 1);
+		constexpr int f[] = { 6, 7 };
+		constexpr StaticArray<int, 7> g = a + f;
+		static_assert(g[5] == 6);
+		constexpr StaticArray<int, 7> h = f + a;
+		static_assert(h[0] == 6);
+		static_assert(h[2] == 1);
+
+		// Copies are unaffected by constant evaluation at runtime
+		StaticArray<int, 5> i = a;
+		i.Sort(SortOrder::Descending);
+		assert(i == c);
+		assert(a[0] == 1);
+	}
 }
\ No newline at end of file
@@ -0,0 +1,265 @@
+#include "UnitTestStaticVector.h"
+
+#include <cassert>
+#include <string>
+
+#include "DynamicArray.h"
+#include "StaticArray.h"
+#include "StaticVector.h"
+
+namespace UnitTests
+{
+	void UnitTestStaticVectorConstructors();
+	void UnitTestStaticVectorAssignment();
+	void UnitTestStaticVectorMethods();
+	void UnitTestStaticVectorConstexpr();
+
+	void UnitTestStaticVector()
+	{
+		UnitTestStaticVectorConstructors();
+		UnitTestStaticVectorAssignment();
+		UnitTestStaticVectorMethods();
+		UnitTestStaticVectorConstexpr();
+	}
+
+	void UnitTestStaticVectorConstructors()
+	{
+		// Default constructor
+		StaticVector<int, 4> a;
+		assert(a.Size() == 0);
+		assert(a.Capacity() == 4);
+		assert(sizeof(a) == sizeof(int) * 4 + sizeof(size_t)); // No pointer to the elements, which are stored inline
+
+		// Conversion copy constructor from initializer list
+		StaticVector<int, 4> b = { 1, 2, 3 };
+		assert(b.Size() == 3);
+		assert(b[0] == 1);
+		assert(b[2] == 3);
+
+		bool success = false;
+		try
+		{
+			StaticVector<int, 2> c = { 1, 2, 3 }; // Invalid - more elements than the capacity
+		}
+		catch (const std::length_error&)
+		{
+			success = true;
+		}
+		assert(success);
+
+		// Copy constructor
+		StaticVector<int, 4> c = b;
+		assert(c == b);
+
+		// Move constructor
+		StaticVector<std::string, 4> d = { "a", "b" };
+		StaticVector<std::string, 4> e = std::move(d);
+		assert(e.Size() == 2);
+		assert(e[1] == "b");
+		assert(d.Size() == 0); // The other vector is left empty
+
+		// Conversion copy constructor from other Array
+		StaticArray<int, 3> f = { 4, 5, 6 };
+		StaticVector<int, 4> g = f;
+		assert(g == f);
+
+		// Conversion copy constructor from c-style array
+		const int h[] = { 1, 2 };
+		StaticVector<int, 4> i = h;
+		assert(i.Size() == 2);
+		assert(i[1] == 2);
+
+		// Adapter to the runtime Array interface
+		StaticVector<int, 4> j = { 1, 2, 3 };
+		ArrayAdapter k(j);
+		Array<int>& l = k;
+		assert(l.Size() == 3);
+		assert(l[2] == 3);
+		assert(l.Fill(4, 3, 4)); // Forwarded to the Static Vector, which grows to fit
+		assert(j.Size() == 4);
+		assert(j[3] == 4);
+	}
+
+	void UnitTestStaticVectorAssignment()
+	{
+		// Copy assignment operator
+		StaticVector<std::string, 4> a = { "a", "b", "c" };
+		StaticVector<std::string, 4> b = { "d" };
+		b = a;
+		assert(b == a);
+
+		// Move assignment operator
+		StaticVector<std::string, 4> c;
+		c = std::move(b);
+		assert(c == a);
+		assert(b.Size() == 0);
+
+		// Conversion copy assignment operator from other Array
+		DynamicArray<int> d = { 1, 2, 3, 4, 5 };
+		StaticVector<int, 4> e;
+		bool success = false;
+		try
+		{
+			e = d; // Invalid - more elements than the capacity
+		}
+		catch (const std::length_error&)
+		{
+			success = true;
+		}
+		assert(success);
+		assert(e.Size() == 0); // The vector is left unchanged
+
+		d.RemoveAt(4);
+		e = d;
+		assert(e == d);
+
+		// Conversion copy assignment operator from initializer list
+		e = { 7, 8 };
+		assert(e.Size() == 2);
+		assert(e[1] == 8);
+	}
+
+	void UnitTestStaticVectorMethods()
+	{
+		// Add method
+		StaticVector<int, 4> a;
+		a.Add(1);
+		a.Add(2);
+		assert(a.Size() == 2);
+		assert(a[1] == 2);
+
+		a.Add({ 3, 4 });
+		assert(a.Full());
+
+		bool success = false;
+		try
+		{
+			a.Add(5); // Invalid - the vector is full
+		}
+		catch (const std::length_error&)
+		{
+			success = true;
+		}
+		assert(success);
+		assert(a.Size() == 4); // The vector is left unchanged
+
+		// Insert method
+		StaticVector<std::string, 4> b = { "a", "c" };
+		b.Insert(1, "b");
+		b.Insert(0, "z");
+		assert(b.Size() == 4);
+		assert(b[0] == "z");
+		assert(b[1] == "a");
+		assert(b[2] == "b");
+		assert(b[3] == "c");
+
+		// Emplace method
+		StaticVector<std::string, 4> c;
+		c.Emplace(3, 'x');
+		c.EmplaceAt(0, "y");
+		assert(c[0] == "y");
+		assert(c[1] == "xxx");
+
+		// Remove method
+		StaticVector<int, 8> d = { 1, 2, 1, 3, 1 };
+		assert(d.Remove(1));
+		assert(d.Size() == 2);
+		assert(d[0] == 2);
+		assert(d[1] == 3);
+		assert(!d.Remove(1));
+
+		// RemoveRange method
+		b.RemoveRange(1, 2);
+		assert(b.Size() == 2);
+		assert(b[0] == "z");
+		assert(b[1] == "c");
+
+		// RemoveAll method
+		assert(b.RemoveAll());
+		assert(b.Size() == 0);
+		assert(!b.RemoveAll());
+
+		// Fill method
+		StaticVector<int, 4> e = { 1 };
+		assert(e.Fill(0)); // Filled up to the capacity
+		assert(e.Size() == 4);
+		assert(e[3] == 0);
+
+		// Array algorithms
+		StaticVector<int, 8> f = { 5, 3, 4, 1, 2 };
+		f.Sort();
+		assert(f[0] == 1);
+		assert(f[4] == 5);
+		assert(f.Contains(4));
+		assert(f.IndexOf(3) == 2);
+		assert(f.BinarySearch(5) == 4);
+
+		// Insert method (elements of the vector)
+		StaticVector<std::string, 8> g = { std::string(32, 'x'), std::string(32, 'y'), std::string(32, 'z') };
+		g.Insert(0, g[1]); // The element is copied before the elements are shifted
+		assert(g.Size() == 4);
+		assert(g[0] == std::string(32, 'y'));
+		assert(g[1] == std::string(32, 'x'));
+		g.Insert(1, g.Data() + 1, 2);
+		assert(g.Size() == 6);
+		assert(g[0] == std::string(32, 'y'));
+		assert(g[1] == std::string(32, 'x'));
+		assert(g[2] == std::string(32, 'y'));
+		assert(g[3] == std::string(32, 'x'));
+		assert(g[4] == std::string(32, 'y'));
+		assert(g[5] == std::string(32, 'z'));
+	}
+
+	// Builds a vector of the squares of the numbers up to the count that aren't multiples of 3
+	constexpr StaticVector<int, 8> Squares(const int count)
+	{
+		StaticVector<int, 8> result;
+		for (int i = 1; i <= count; ++i)
+		{
+			result.Add(i * i);
+		}
+		result.Remove([](const int& element) { return element % 3 == 0; });
+		result.Insert(0, 0);
+		return result;
+	}
+
+	// Returns the total length of the strings after building and editing a vector of them
+	constexpr size_t Lengths()
+	{
+		StaticVector<std::string, 4> strings = { "a", "bb" };
+		strings.Insert(0, "ccc");
+		strings.RemoveAt(1);
+		size_t length = 0;
+		for (const std::string& element : strings)
+		{
+			length += element.size();
+		}
+		return length;
+	}
+
+	// Returns the first three elements as digits after inserting elements of a vector into itself
+	constexpr int InsertElements()
+	{
+		StaticVector<int, 8> vector = { 1, 2, 3 };
+		vector.Insert(0, vector[2]);
+		vector.Insert(0, vector.Data() + 2, 2);
+		return vector[0] * 100 + vector[1] * 10 + vector[2];
+	}
+
+	void UnitTestStaticVectorConstexpr()
+	{
+		// Constexpr variable
+		constexpr StaticVector<int, 8> a = Squares(5);
+		static_assert(a.Size() == 5);
+		static_assert(a[0] == 0);
+		static_assert(a[1] == 1);
+		static_assert(a[3] == 16);
+		static_assert(a[4] == 25);
+
+		// Non-trivial elements within a constant expression
+		static_assert(Lengths() == 5);
+
+		// Inserting elements of the vector within a constant expression
+		static_assert(InsertElements() == 233);
+	}
+}
@@ -2,8 +2,15 @@
 
 #include <iostream>
 
+#include "UnitTestAllocators.h"
+#include "UnitTestArrayView.h"
 #include "UnitTestDynamicArray.h"
+#include "UnitTestLazyArray.h"
+#include "UnitTestPerfectHashMap.h"
+#include "UnitTestSimd.h"
+#include "UnitTestSmallArray.h"
 #include "UnitTestStaticArray.h"
+#include "UnitTestStaticVector.h"
 
 namespace UnitTests
 {
@@ -11,6 +18,13 @@ namespace UnitTests
 	{
 		UnitTestStaticArray();
 		UnitTestDynamicArray();
+		UnitTestArrayView();
+		UnitTestLazyArray();
+		UnitTestAllocators();
+		UnitTestSmallArray();
+		UnitTestStaticVector();
+		UnitTestPerfectHashMap();
+		UnitTestSimd();
 
 		std::cout << "All tests passed!" << std::endl;
 	}